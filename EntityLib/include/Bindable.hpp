@@ -0,0 +1,40 @@
+#ifndef BINDABLE_HPP
+#define BINDABLE_HPP
+
+namespace psin {
+
+// Bindable<T> holds a value of type T that is stored either inside the object
+// itself or, once bound, in an external storage (such as a ParticleStore column).
+// Reading and writing always go to the current storage. Copies never share the
+// external storage: a copy owns its value.
+template<typename T>
+class Bindable
+{
+	public:
+		Bindable();
+		explicit Bindable(const T & value);
+		Bindable(const Bindable & other);
+
+		// Writes other's value into the current storage, keeping the binding
+		Bindable & operator=(const Bindable & other);
+		Bindable & operator=(const T & value);
+
+		T & get();
+		const T & get() const;
+
+		// Moves the current value into *external and uses it from then on
+		void bind(T * external);
+		// Copies the value back into the object and stops using the external storage
+		void unbind();
+		bool isBound() const;
+
+	private:
+		T value;
+		T * pointer;
+};
+
+} // psin
+
+#include <Bindable.tpp>
+
+#endif // BINDABLE_HPP
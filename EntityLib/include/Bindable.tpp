@@ -0,0 +1,69 @@
+#ifndef BINDABLE_TPP
+#define BINDABLE_TPP
+
+namespace psin {
+
+template<typename T>
+Bindable<T>::Bindable()
+	: value(), pointer(&value)
+{}
+
+template<typename T>
+Bindable<T>::Bindable(const T & value)
+	: value(value), pointer(&this->value)
+{}
+
+template<typename T>
+Bindable<T>::Bindable(const Bindable & other)
+	: value(other.get()), pointer(&value)
+{}
+
+template<typename T>
+Bindable<T> & Bindable<T>::operator=(const Bindable & other)
+{
+	*pointer = other.get();
+	return *this;
+}
+
+template<typename T>
+Bindable<T> & Bindable<T>::operator=(const T & value)
+{
+	*pointer = value;
+	return *this;
+}
+
+template<typename T>
+T & Bindable<T>::get()
+{
+	return *pointer;
+}
+
+template<typename T>
+const T & Bindable<T>::get() const
+{
+	return *pointer;
+}
+
+template<typename T>
+void Bindable<T>::bind(T * external)
+{
+	*external = *pointer;
+	pointer = external;
+}
+
+template<typename T>
+void Bindable<T>::unbind()
+{
+	value = *pointer;
+	pointer = &value;
+}
+
+template<typename T>
+bool Bindable<T>::isBound() const
+{
+	return pointer != &value;
+}
+
+} // psin
+
+#endif // BINDABLE_TPP
@@ -2,6 +2,7 @@
 #define BOUNDARY_HPP
 
 // EntityLib
+#include <HandledEntity.hpp>
 #include <PhysicalEntity.hpp>
 
 // UtilsLib
@@ -12,6 +13,7 @@ namespace psin {
 template<typename ... PropertyTypes>
 class Boundary : 
     public Named,
+    public HandledEntity,
     public PhysicalEntity<PropertyTypes...>
 {
 	public:
@@ -0,0 +1,89 @@
+#ifndef DYNAMICS_RECORDER_HPP
+#define DYNAMICS_RECORDER_HPP
+
+// UtilsLib
+#include <Vector3D.hpp>
+
+// Standard
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace psin {
+
+// DynamicsRecorder collects the changes interactions make to particles, so that several
+// threads can evaluate interactions at the same time and apply their results afterwards.
+//
+// While a recorder is active on a thread (see Scope), the particles' addBodyForce,
+// addContactForce, addTorque and setNormalForce called on that thread are handed to the
+// recorder instead of being applied. apply() then replays them in the order they were made.
+//
+// Additions to a tracked column (e.g. a ParticleStore's force column) are not recorded one
+// by one: they are summed into the recorder's own copy of the column, to be added to the
+// column by reduceColumns. This is cheaper, but the additions are then rounded in a
+// different order than if they were applied one after another.
+class DynamicsRecorder
+{
+	public:
+		// Activates a recorder on the current thread for the lifetime of the Scope
+		class Scope
+		{
+			public:
+				explicit Scope(DynamicsRecorder & recorder);
+				~Scope();
+
+				Scope(const Scope &) = delete;
+				Scope & operator=(const Scope &) = delete;
+
+			private:
+				DynamicsRecorder * previous;
+		};
+
+		// The recorder active on the current thread, or nullptr
+		static DynamicsRecorder * active();
+
+		void add(Vector3D & accumulator, const Vector3D & value);
+		void assign(std::unordered_map<int, Vector3D> & map, const int key, const Vector3D & value);
+
+		void track(Vector3D * column, const std::size_t size);
+		std::size_t numberOfTrackedColumns() const;
+
+		// Adds every recorder's partial sums to the tracked columns, in the recorders' order, for
+		// the elements [begin, end) of the column-th tracked column, and zeroes those partial sums.
+		// All recorders must track the same columns.
+		static void reduceColumns(std::vector<DynamicsRecorder> & recorders, const std::size_t column, const std::size_t begin, const std::size_t end);
+
+		// Applies the recorded changes in the order they were made and forgets them
+		void apply();
+
+		bool empty() const;
+
+	private:
+		struct Addition
+		{
+			Vector3D * accumulator;
+			Vector3D value;
+		};
+
+		struct Assignment
+		{
+			std::unordered_map<int, Vector3D> * map;
+			int key;
+			Vector3D value;
+		};
+
+		struct Column
+		{
+			Vector3D * data;
+			std::size_t size;
+			std::vector<Vector3D> partialSum;
+		};
+
+		std::vector<Addition> additions;
+		std::vector<Assignment> assignments;
+		std::vector<Column> columns;
+};
+
+} // psin
+
+#endif // DYNAMICS_RECORDER_HPP
@@ -0,0 +1,88 @@
+#ifndef FIXED_ORDER_SPATIAL_ENTITY_HPP
+#define FIXED_ORDER_SPATIAL_ENTITY_HPP
+
+// EntityLib
+#include <SpatialEntity.hpp>
+
+// UtilsLib
+#include <Vector3D.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#define MAX_FIXED_TAYLOR_ORDER 7
+
+namespace psin {
+
+// FixedOrderSpatialEntity is a SpatialEntity whose Taylor order is known at compile time.
+// Its position and orientation matrices are std::arrays, so predicting and correcting them
+// in place (see Interaction<>::taylorPredict and Interaction<>::gearCorrect) never allocates.
+template<std::size_t TaylorOrder>
+class FixedOrderSpatialEntity
+{
+	public:
+		using TaylorMatrix = std::array<Vector3D, TaylorOrder + 1>;
+
+		constexpr static std::size_t taylorOrder = TaylorOrder;
+
+		FixedOrderSpatialEntity();
+		explicit FixedOrderSpatialEntity(const SpatialEntity & spatial); // throws
+
+		// ----- Position -----
+		void setPosition(const Vector3D & position);
+		void setVelocity(const Vector3D & velocity);
+		void setAcceleration(const Vector3D & acceleration);
+		void setPositionDerivative(const std::size_t derivative, const Vector3D & vec); // throws
+
+		Vector3D getPosition() const;
+		Vector3D getVelocity() const;
+		Vector3D getAcceleration() const;
+		Vector3D getPositionDerivative(const std::size_t derivative) const; // throws
+
+		TaylorMatrix & positionMatrix();
+		const TaylorMatrix & positionMatrix() const;
+
+		// ----- Orientation -----
+		void setOrientation(const Vector3D & orientation);
+		void setAngularVelocity(const Vector3D & angularVelocity);
+		void setAngularAcceleration(const Vector3D & angularAcceleration);
+		void setOrientationDerivative(const std::size_t derivative, const Vector3D & vec); // throws
+
+		Vector3D getOrientation() const;
+		Vector3D getAngularVelocity() const;
+		Vector3D getAngularAcceleration() const;
+		Vector3D getOrientationDerivative(const std::size_t derivative) const; // throws
+
+		TaylorMatrix & orientationMatrix();
+		const TaylorMatrix & orientationMatrix() const;
+
+		// ----- Taylor Order -----
+		std::size_t getTaylorOrder() const;
+
+		SpatialEntity toSpatialEntity() const;
+
+	private:
+		TaylorMatrix position;
+		TaylorMatrix orientation;
+};
+
+template<std::size_t TaylorOrder>
+void from_json(const json& j, FixedOrderSpatialEntity<TaylorOrder> & spatial);
+template<std::size_t TaylorOrder>
+void to_json(json& j, const FixedOrderSpatialEntity<TaylorOrder> & spatial);
+
+// Calls function(std::integral_constant<std::size_t, taylorOrder>()), turning a Taylor order read
+// at runtime into a compile time constant. Orders above MAX_FIXED_TAYLOR_ORDER are not supported.
+template<typename Function>
+void dispatchTaylorOrder(const std::size_t taylorOrder, Function && function); // throws
+
+} // psin
+
+#include <FixedOrderSpatialEntity.tpp>
+
+#endif // FIXED_ORDER_SPATIAL_ENTITY_HPP
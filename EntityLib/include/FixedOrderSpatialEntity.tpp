@@ -0,0 +1,227 @@
+#ifndef FIXED_ORDER_SPATIAL_ENTITY_TPP
+#define FIXED_ORDER_SPATIAL_ENTITY_TPP
+
+// Standard
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace psin {
+
+template<std::size_t TaylorOrder>
+void from_json(const json& j, FixedOrderSpatialEntity<TaylorOrder> & spatial)
+{
+	SpatialEntity s = j;
+	spatial = FixedOrderSpatialEntity<TaylorOrder>(s);
+}
+
+template<std::size_t TaylorOrder>
+void to_json(json& j, const FixedOrderSpatialEntity<TaylorOrder> & spatial)
+{
+	j = spatial.toSpatialEntity();
+}
+
+template<std::size_t TaylorOrder>
+FixedOrderSpatialEntity<TaylorOrder>::FixedOrderSpatialEntity()
+	: position(), orientation()
+{}
+
+template<std::size_t TaylorOrder>
+FixedOrderSpatialEntity<TaylorOrder>::FixedOrderSpatialEntity(const SpatialEntity & spatial)
+	: position(), orientation()
+{
+	if(spatial.getTaylorOrder() > TaylorOrder)
+	{
+		throw std::runtime_error("SpatialEntity's Taylor order is higher than " + std::to_string(TaylorOrder));
+	}
+
+	for(std::size_t derivative = 0; derivative <= spatial.getTaylorOrder(); ++derivative)
+	{
+		position[derivative] = spatial.getPositionDerivative(derivative);
+		orientation[derivative] = spatial.getOrientationDerivative(derivative);
+	}
+}
+
+// ----- Position -----
+template<std::size_t TaylorOrder>
+void FixedOrderSpatialEntity<TaylorOrder>::setPosition(const Vector3D & position)
+{
+	this->setPositionDerivative(0, position);
+}
+
+template<std::size_t TaylorOrder>
+void FixedOrderSpatialEntity<TaylorOrder>::setVelocity(const Vector3D & velocity)
+{
+	this->setPositionDerivative(1, velocity);
+}
+
+template<std::size_t TaylorOrder>
+void FixedOrderSpatialEntity<TaylorOrder>::setAcceleration(const Vector3D & acceleration)
+{
+	this->setPositionDerivative(2, acceleration);
+}
+
+template<std::size_t TaylorOrder>
+void FixedOrderSpatialEntity<TaylorOrder>::setPositionDerivative(const std::size_t derivative, const Vector3D & vec)
+{
+	if(derivative > TaylorOrder)
+	{
+		throw std::runtime_error("Invalid derivative inserted. Derivative must be positive and less or equal to taylorOrder");
+	}
+	this->position[derivative] = vec;
+}
+
+template<std::size_t TaylorOrder>
+Vector3D FixedOrderSpatialEntity<TaylorOrder>::getPosition() const
+{
+	return this->getPositionDerivative(0);
+}
+
+template<std::size_t TaylorOrder>
+Vector3D FixedOrderSpatialEntity<TaylorOrder>::getVelocity() const
+{
+	return this->getPositionDerivative(1);
+}
+
+template<std::size_t TaylorOrder>
+Vector3D FixedOrderSpatialEntity<TaylorOrder>::getAcceleration() const
+{
+	return this->getPositionDerivative(2);
+}
+
+template<std::size_t TaylorOrder>
+Vector3D FixedOrderSpatialEntity<TaylorOrder>::getPositionDerivative(const std::size_t derivative) const
+{
+	if(derivative > TaylorOrder)
+	{
+		throw std::runtime_error("Invalid derivative inserted. Derivative must be positive and less or equal to taylorOrder");
+	}
+	return this->position[derivative];
+}
+
+template<std::size_t TaylorOrder>
+typename FixedOrderSpatialEntity<TaylorOrder>::TaylorMatrix & FixedOrderSpatialEntity<TaylorOrder>::positionMatrix()
+{
+	return this->position;
+}
+
+template<std::size_t TaylorOrder>
+const typename FixedOrderSpatialEntity<TaylorOrder>::TaylorMatrix & FixedOrderSpatialEntity<TaylorOrder>::positionMatrix() const
+{
+	return this->position;
+}
+
+// ----- Orientation -----
+template<std::size_t TaylorOrder>
+void FixedOrderSpatialEntity<TaylorOrder>::setOrientation(const Vector3D & orientation)
+{
+	this->setOrientationDerivative(0, orientation);
+}
+
+template<std::size_t TaylorOrder>
+void FixedOrderSpatialEntity<TaylorOrder>::setAngularVelocity(const Vector3D & angularVelocity)
+{
+	this->setOrientationDerivative(1, angularVelocity);
+}
+
+template<std::size_t TaylorOrder>
+void FixedOrderSpatialEntity<TaylorOrder>::setAngularAcceleration(const Vector3D & angularAcceleration)
+{
+	this->setOrientationDerivative(2, angularAcceleration);
+}
+
+template<std::size_t TaylorOrder>
+void FixedOrderSpatialEntity<TaylorOrder>::setOrientationDerivative(const std::size_t derivative, const Vector3D & vec)
+{
+	if(derivative > TaylorOrder)
+	{
+		throw std::runtime_error("Invalid derivative inserted. Derivative must be positive and less or equal to taylorOrder");
+	}
+	this->orientation[derivative] = vec;
+}
+
+template<std::size_t TaylorOrder>
+Vector3D FixedOrderSpatialEntity<TaylorOrder>::getOrientation() const
+{
+	return this->getOrientationDerivative(0);
+}
+
+template<std::size_t TaylorOrder>
+Vector3D FixedOrderSpatialEntity<TaylorOrder>::getAngularVelocity() const
+{
+	return this->getOrientationDerivative(1);
+}
+
+template<std::size_t TaylorOrder>
+Vector3D FixedOrderSpatialEntity<TaylorOrder>::getAngularAcceleration() const
+{
+	return this->getOrientationDerivative(2);
+}
+
+template<std::size_t TaylorOrder>
+Vector3D FixedOrderSpatialEntity<TaylorOrder>::getOrientationDerivative(const std::size_t derivative) const
+{
+	if(derivative > TaylorOrder)
+	{
+		throw std::runtime_error("Invalid derivative inserted. Derivative must be positive and less or equal to taylorOrder");
+	}
+	return this->orientation[derivative];
+}
+
+template<std::size_t TaylorOrder>
+typename FixedOrderSpatialEntity<TaylorOrder>::TaylorMatrix & FixedOrderSpatialEntity<TaylorOrder>::orientationMatrix()
+{
+	return this->orientation;
+}
+
+template<std::size_t TaylorOrder>
+const typename FixedOrderSpatialEntity<TaylorOrder>::TaylorMatrix & FixedOrderSpatialEntity<TaylorOrder>::orientationMatrix() const
+{
+	return this->orientation;
+}
+
+// ----- Taylor Order -----
+template<std::size_t TaylorOrder>
+std::size_t FixedOrderSpatialEntity<TaylorOrder>::getTaylorOrder() const
+{
+	return TaylorOrder;
+}
+
+template<std::size_t TaylorOrder>
+SpatialEntity FixedOrderSpatialEntity<TaylorOrder>::toSpatialEntity() const
+{
+	SpatialEntity spatial(TaylorOrder);
+	spatial.setPositionMatrix( std::vector<Vector3D>(position.begin(), position.end()) );
+	spatial.setOrientationMatrix( std::vector<Vector3D>(orientation.begin(), orientation.end()) );
+	return spatial;
+}
+
+// ----- Dispatch -----
+namespace detail {
+
+template<typename Function, std::size_t ... Orders>
+void dispatchTaylorOrder(const std::size_t taylorOrder, Function && function, std::index_sequence<Orders...>)
+{
+	const bool dispatched = (
+		(taylorOrder == Orders ? (function(std::integral_constant<std::size_t, Orders>()), true) : false)
+		or ...
+	);
+
+	if(not dispatched)
+	{
+		throw std::runtime_error("There is no support for Taylor order " + std::to_string(taylorOrder)
+			+ ". Taylor order must be at most " + std::to_string(MAX_FIXED_TAYLOR_ORDER) + ".");
+	}
+}
+
+} // detail
+
+template<typename Function>
+void dispatchTaylorOrder(const std::size_t taylorOrder, Function && function)
+{
+	detail::dispatchTaylorOrder(taylorOrder, function, std::make_index_sequence<MAX_FIXED_TAYLOR_ORDER + 1>());
+}
+
+} // psin
+
+#endif // FIXED_ORDER_SPATIAL_ENTITY_TPP
@@ -1,10 +1,17 @@
 #ifndef HANDLED_ENTITY_HPP
 #define HANDLED_ENTITY_HPP
 
+// Standard
+#include <cstddef>
+#include <utility>
+
 #define DEFAULT_HANDLED_ENTITY_HANDLE -1
 
 namespace psin {
 
+// A handle is a dense integer identifying an entity in a simulation.
+// Per-pair state (contact forces, collision histories etc.) is keyed by handle pairs.
+
 class HandledEntity
 {
 	public:
@@ -22,6 +29,16 @@ class HandledEntity
 
 bool operator==( const HandledEntity & left, const HandledEntity & right );
 
+using handle_pair = std::pair<int, int>;
+
+// Identifies a pair of entities regardless of which one comes first
+handle_pair makeHandlePair( const HandledEntity & left, const HandledEntity & right );
+
+struct handle_pair_hash
+{
+	std::size_t operator()(const handle_pair & pair) const;
+};
+
 } // psin
 
 #endif
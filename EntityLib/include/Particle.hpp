@@ -6,6 +6,9 @@
 #include <string.hpp>
 
 // EntityLib
+#include <Bindable.hpp>
+#include <DynamicsRecorder.hpp>
+#include <HandledEntity.hpp>
 #include <PhysicalEntity.hpp>
 #include <SocialEntity.hpp>
 #include <SpatialEntity.hpp>
@@ -13,11 +16,15 @@
 // PropertyLib
 #include <PropertyDefinitions.hpp>
 
+// Standard
+#include <unordered_map>
+
 namespace psin {
 
 template<typename ... PropertyTypes>
 class Particle :
 	public Named,
+	public HandledEntity,
 	public PhysicalEntity<Mass, MomentOfInertia, PropertyTypes...>,
 	public SpatialEntity
 {
@@ -29,6 +36,8 @@ class Particle :
 		explicit Particle(const BasePhysicalEntity & physical, const SpatialEntity & spatial = SpatialEntity(), const string & name = Named::defaultName);
 		
 		// ---- Dynamics ----
+		// addBodyForce, addContactForce, addTorque and setNormalForce are recorded instead of
+		// applied while a DynamicsRecorder is active on the calling thread
 		void addBodyForce(const Vector3D & force);
 		void addContactForce(const Vector3D & force);
 		void setBodyForce(const Vector3D & force);
@@ -54,14 +63,19 @@ class Particle :
 		double getKineticEnergy(void) const;
 		double getTranslationalEnergy(void) const;
 		double getRotationalEnergy(void) const;
+
+		// ---- External storage ----
+		// Forces and torque may live in a ParticleStore instead of in the particle itself
+		void bindDynamicsStorage(Vector3D * bodyForce, Vector3D * contactForce, Vector3D * resultingTorque);
+		void unbindDynamicsStorage();
 		
 	private:
-		Vector3D bodyForce;
-		Vector3D contactForce;
+		Bindable<Vector3D> bodyForce;
+		Bindable<Vector3D> contactForce;
 
-		Vector3D resultingTorque;
+		Bindable<Vector3D> resultingTorque;
 
-		std::map<string, Vector3D> normalForceMap;
+		std::unordered_map<int, Vector3D> normalForceMap;	// keyed by the neighbor's handle
 };
 
 template<typename...Prs>
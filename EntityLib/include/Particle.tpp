@@ -80,12 +80,14 @@ Particle<PropertyTypes...>::Particle(const BasePhysicalEntity & physical, const
 template<typename ... PropertyTypes>
 void Particle<PropertyTypes...>::addBodyForce(const Vector3D & force)
 { 
-	this->bodyForce += force; 
+	if(DynamicsRecorder * recorder = DynamicsRecorder::active()) recorder->add(this->bodyForce.get(), force);
+	else this->bodyForce.get() += force; 
 }
 template<typename ... PropertyTypes>
 void Particle<PropertyTypes...>::addContactForce(const Vector3D & force)
 { 
-	this->contactForce += force; 
+	if(DynamicsRecorder * recorder = DynamicsRecorder::active()) recorder->add(this->contactForce.get(), force);
+	else this->contactForce.get() += force; 
 }
 template<typename ... PropertyTypes>
 void Particle<PropertyTypes...>::setBodyForce(const Vector3D & force)
@@ -101,24 +103,25 @@ template<typename ... PropertyTypes>
 template<typename NeighborType>
 void Particle<PropertyTypes...>::setNormalForce(NeighborType&& neighbor, const Vector3D & force)
 { 
-	this->normalForceMap[neighbor.getName()] = force;
+	if(DynamicsRecorder * recorder = DynamicsRecorder::active()) recorder->assign(this->normalForceMap, neighbor.getHandle(), force);
+	else this->normalForceMap[neighbor.getHandle()] = force;
 }
 template<typename ... PropertyTypes>
 template<typename NeighborType>
 Vector3D Particle<PropertyTypes...>::getNormalForce(NeighborType&& neighbor) const
 { 
-	return this->normalForceMap.at(neighbor.getName());
+	return this->normalForceMap.at(neighbor.getHandle());
 }
 
 template<typename ... PropertyTypes>
 Vector3D Particle<PropertyTypes...>::getBodyForce(void) const 
 { 
-	return this->bodyForce; 
+	return this->bodyForce.get(); 
 }
 template<typename ... PropertyTypes>
 Vector3D Particle<PropertyTypes...>::getContactForce(void) const 
 { 
-	return this->contactForce; 
+	return this->contactForce.get(); 
 }
 template<typename ... PropertyTypes>
 Vector3D Particle<PropertyTypes...>::getResultingForce(void) const 
@@ -129,7 +132,8 @@ Vector3D Particle<PropertyTypes...>::getResultingForce(void) const
 template<typename ... PropertyTypes>		
 void Particle<PropertyTypes...>::addTorque(const Vector3D & torque)
 { 
-	this->resultingTorque += torque; 
+	if(DynamicsRecorder * recorder = DynamicsRecorder::active()) recorder->add(this->resultingTorque.get(), torque);
+	else this->resultingTorque.get() += torque; 
 }
 template<typename ... PropertyTypes>
 void Particle<PropertyTypes...>::setResultingTorque(const Vector3D & torque)
@@ -139,7 +143,22 @@ void Particle<PropertyTypes...>::setResultingTorque(const Vector3D & torque)
 template<typename ... PropertyTypes>
 Vector3D Particle<PropertyTypes...>::getResultingTorque() const 
 { 
-	return this->resultingTorque; 
+	return this->resultingTorque.get(); 
+}
+
+template<typename ... PropertyTypes>
+void Particle<PropertyTypes...>::bindDynamicsStorage(Vector3D * bodyForce, Vector3D * contactForce, Vector3D * resultingTorque)
+{
+	this->bodyForce.bind(bodyForce);
+	this->contactForce.bind(contactForce);
+	this->resultingTorque.bind(resultingTorque);
+}
+template<typename ... PropertyTypes>
+void Particle<PropertyTypes...>::unbindDynamicsStorage()
+{
+	this->bodyForce.unbind();
+	this->contactForce.unbind();
+	this->resultingTorque.unbind();
 }
 
 template<typename ... PropertyTypes>
@@ -38,14 +38,18 @@ class PhysicalEntity
 		PropertyType& property();
 
 		template<typename PropertyType>
-		PropertyType property() const;
+		const PropertyType & property() const;
 
 		// ----- Set and get property -----
 		template<typename PropertyType, typename ValueType>
 		void set(const ValueType & value);
 
 		template<typename PropertyType>
-		typename PropertyType::ValueType get() const;
+		typename PropertyType::ValueType get() const; // throws
+
+		// Does not check whether the property was assigned; see Property<T>::getUnchecked
+		template<typename PropertyType>
+		const typename PropertyType::ValueType & getUnchecked() const;
 
 		// ----- Check whether a property was assigned -----
 		template<typename PropertyType>
@@ -16,7 +16,7 @@ void from_json(const json& j, PhysicalEntity<Prs...> & p)
 	using TypeList = typename PhysicalEntity<Prs...>::PropertyList;
 
 	mp::for_each<mp::provide_indices<TypeList>>(
-	[&](auto&& i)
+	[&](auto i)
 	{
 		using P = typename mp::get<i, TypeList>::type;
 		if(j.count(NamedType<P>::name) > 0)
@@ -32,7 +32,7 @@ void to_json(json& j, const PhysicalEntity<Prs...> & p)
 	using TypeList = typename PhysicalEntity<Prs...>::PropertyList;
 
 	mp::for_each<mp::provide_indices<TypeList>>(
-	[&](auto&& i)
+	[&](auto i)
 	{
 		using P = typename mp::get<i, TypeList>::type;
 		if(p.template assigned<P>()) j[NamedType<P>::name] = p.template get<P>();
@@ -65,7 +65,7 @@ PropertyType& PhysicalEntity<PropertyTypes...>::property()
 
 template<typename ... PropertyTypes>
 template<typename PropertyType>
-PropertyType PhysicalEntity<PropertyTypes...>::property() const
+const PropertyType & PhysicalEntity<PropertyTypes...>::property() const
 {
 	static_assert(mp::type_list<PropertyTypes...>::template contains<PropertyType>, "Template parameter for function 'PhysicalEntity<PropertyTypes...>::property' must be in template parameter list in the specialization of 'PhysicalEntity'");
 
@@ -93,6 +93,16 @@ typename PropertyType::ValueType PhysicalEntity<PropertyTypes...>::get() const
 	return this->template property<PropertyType>().get();
 }
 
+template<typename ... PropertyTypes>
+template<typename PropertyType>
+const typename PropertyType::ValueType & PhysicalEntity<PropertyTypes...>::getUnchecked() const
+{
+	static_assert(mp::type_list<PropertyTypes...>::template contains<PropertyType>, 
+		"Template parameter for function 'PhysicalEntity<PropertyTypes...>::getUnchecked' must be in template parameter list in the specialization of 'PhysicalEntity'");
+
+	return this->template property<PropertyType>().getUnchecked();
+}
+
 // ----- Check whether a property was assigned -----
 template<typename ... PropertyTypes>
 template<typename PropertyType>
@@ -19,6 +19,10 @@ class SpatialEntity
 	public:
 		SpatialEntity();
 		explicit SpatialEntity(const std::size_t taylorOrder);
+		SpatialEntity(const SpatialEntity & other);
+
+		// Keeps an existing binding: values are written into the external storage
+		SpatialEntity & operator=(const SpatialEntity & other); // throws
 
 		// ----- Position -----
 		void setPosition(const double x, const double y, const double z = 0);
@@ -69,19 +73,34 @@ class SpatialEntity
 		void setTaylorOrder(const std::size_t taylorOrder); // throws
 		std::size_t getTaylorOrder() const;
 
+		// ----- External storage -----
+		// Position and orientation matrices may live in an external, derivative-major storage (see ParticleStore).
+		// The n-th derivatives are then position[n * stride] and orientation[n * stride], for n up to maxTaylorOrder;
+		// entries above this entity's Taylor order are kept null. The Taylor order of a bound entity cannot change.
+		void bindSpatialStorage(Vector3D * position, Vector3D * orientation, const std::size_t stride, const std::size_t maxTaylorOrder); // throws
+		void unbindSpatialStorage();
+		bool isSpatialStorageBound() const;
 
 	private:
 		// memory function
 		void resizePositionOrientation(void);
 
 		// set spatial position
-		void setSpatial(std::vector<Vector3D> & spatial, const std::size_t derivative, const double x, const double y, const double z = 0);
-		void setSpatial(std::vector<Vector3D> & spatial, const std::size_t derivative, const Vector3D & vec);
-		void setSpatial(std::vector<Vector3D> & spatialToSet, const std::vector<Vector3D> & spatial);
+		void setSpatial(Vector3D * spatial, const std::size_t derivative, const double x, const double y, const double z = 0);
+		void setSpatial(Vector3D * spatial, const std::size_t derivative, const Vector3D & vec);
+		void setSpatial(Vector3D * spatialToSet, const std::vector<Vector3D> & spatial);
+
+		std::vector<Vector3D> getSpatial(const Vector3D * spatial) const;
 
+		// owned storage, used while the entity is not bound
 		std::vector<Vector3D>	positionMatrix;
 		std::vector<Vector3D>	orientationMatrix;
 
+		Vector3D * positionData = nullptr;
+		Vector3D * orientationData = nullptr;
+		std::size_t stride = 1;
+		bool spatialStorageBound = false;
+
 		std::size_t taylorOrder;
 };
 
@@ -54,8 +54,8 @@ double distance(const SphericalParticle<Ts...> & lhs, const FixedInfinitePlane<U
 template<typename...Ts, typename...Us>
 bool touch(const SphericalParticle<Ts...> & left, const SphericalParticle<Us...> & right)
 {
-	double radius1 = left.template get<Radius>();
-	double radius2 = right.template get<Radius>();
+	double radius1 = left.template getUnchecked<Radius>();
+	double radius2 = right.template getUnchecked<Radius>();
 
 	return (distance(left, right) <= radius1 + radius2);
 }
@@ -63,14 +63,14 @@ bool touch(const SphericalParticle<Ts...> & left, const SphericalParticle<Us...>
 template<typename...Ts, typename...Us>
 bool touch(const SphericalParticle<Ts...> & lhs, const FixedInfinitePlane<Us...> & rhs)
 {
-	return lhs.template get<Radius>() >= distance(lhs, rhs);
+	return lhs.template getUnchecked<Radius>() >= distance(lhs, rhs);
 }
 
 template<typename...Ts, typename...Us>
 double overlap(const SphericalParticle<Ts...> & left, const SphericalParticle<Us...> & right)
 {
-	double radius1 = left.template get<Radius>();
-	double radius2 = right.template get<Radius>();
+	double radius1 = left.template getUnchecked<Radius>();
+	double radius2 = right.template getUnchecked<Radius>();
 	double dist = distance(left, right);
 	double overlap = 0;
 
@@ -87,7 +87,7 @@ double overlap(const SphericalParticle<Ts...> & lhs, const FixedInfinitePlane<Us
 {
 	if(touch(lhs, rhs))
 	{
-		return lhs.template get<Radius>() - distance(lhs, rhs);
+		return lhs.template getUnchecked<Radius>() - distance(lhs, rhs);
 	}
 	else
 	{
@@ -141,8 +141,8 @@ Vector3D contactRadialVector(const SphericalParticle<Ts...> & lhs, const Spheric
 {
 	if( touch(lhs, rhs) )
 	{
-		const double radius1 = lhs.template get<Radius>();
-		const double radius2 = rhs.template get<Radius>();
+		const double radius1 = lhs.template getUnchecked<Radius>();
+		const double radius2 = rhs.template getUnchecked<Radius>();
 
 		const double distance = psin::distance(lhs, rhs);
 
@@ -0,0 +1,93 @@
+#include <DynamicsRecorder.hpp>
+
+namespace psin {
+
+namespace {
+
+thread_local DynamicsRecorder * activeRecorder = nullptr;
+
+} // anonymous namespace
+
+DynamicsRecorder::Scope::Scope(DynamicsRecorder & recorder)
+	: previous(activeRecorder)
+{
+	activeRecorder = &recorder;
+}
+
+DynamicsRecorder::Scope::~Scope()
+{
+	activeRecorder = this->previous;
+}
+
+DynamicsRecorder * DynamicsRecorder::active()
+{
+	return activeRecorder;
+}
+
+void DynamicsRecorder::add(Vector3D & accumulator, const Vector3D & value)
+{
+	for(Column & column : this->columns)
+	{
+		if(&accumulator >= column.data and &accumulator < column.data + column.size)
+		{
+			column.partialSum[&accumulator - column.data] += value;
+			return;
+		}
+	}
+
+	this->additions.push_back( Addition{&accumulator, value} );
+}
+
+void DynamicsRecorder::assign(std::unordered_map<int, Vector3D> & map, const int key, const Vector3D & value)
+{
+	this->assignments.push_back( Assignment{&map, key, value} );
+}
+
+void DynamicsRecorder::track(Vector3D * column, const std::size_t size)
+{
+	this->columns.push_back( Column{column, size, std::vector<Vector3D>(size, nullVector3D())} );
+}
+
+std::size_t DynamicsRecorder::numberOfTrackedColumns() const
+{
+	return this->columns.size();
+}
+
+void DynamicsRecorder::reduceColumns(std::vector<DynamicsRecorder> & recorders, const std::size_t column, const std::size_t begin, const std::size_t end)
+{
+	if(recorders.empty()) return;
+
+	Vector3D * data = recorders.front().columns[column].data;
+	for(DynamicsRecorder & recorder : recorders)
+	{
+		std::vector<Vector3D> & partialSum = recorder.columns[column].partialSum;
+		for(std::size_t i = begin; i < end; ++i)
+		{
+			data[i] += partialSum[i];
+			partialSum[i] = nullVector3D();
+		}
+	}
+}
+
+void DynamicsRecorder::apply()
+{
+	for(const Addition & addition : this->additions)
+	{
+		*addition.accumulator += addition.value;
+	}
+
+	for(const Assignment & assignment : this->assignments)
+	{
+		(*assignment.map)[assignment.key] = assignment.value;
+	}
+
+	this->additions.clear();
+	this->assignments.clear();
+}
+
+bool DynamicsRecorder::empty() const
+{
+	return this->additions.empty() and this->assignments.empty();
+}
+
+} // psin
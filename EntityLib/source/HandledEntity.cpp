@@ -1,5 +1,8 @@
 #include <HandledEntity.hpp>
 
+// Standard
+#include <cstdint>
+
 namespace psin {
 
 // Constructor
@@ -33,4 +36,22 @@ bool operator==( const HandledEntity & left, const HandledEntity & right)
 	return left.getHandle() == right.getHandle();
 }
 
+handle_pair makeHandlePair( const HandledEntity & left, const HandledEntity & right )
+{
+	const int leftHandle = left.getHandle();
+	const int rightHandle = right.getHandle();
+
+	return leftHandle < rightHandle ? handle_pair(leftHandle, rightHandle) : handle_pair(rightHandle, leftHandle);
+}
+
+std::size_t handle_pair_hash::operator()(const handle_pair & pair) const
+{
+	std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(pair.first)) << 32) | static_cast<std::uint32_t>(pair.second);
+
+	// Mixes every bit of both handles into the low bits, which open-addressing tables use as an index
+	key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+	key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+	return static_cast<std::size_t>( key ^ (key >> 31) );
+}
+
 } // psin
\ No newline at end of file
@@ -70,69 +70,106 @@ SpatialEntity::SpatialEntity(const std::size_t taylorOrder)
 	this->setTaylorOrder(taylorOrder);
 }
 
+SpatialEntity::SpatialEntity(const SpatialEntity & other)
+	: positionMatrix(other.getPositionMatrix()),
+	orientationMatrix(other.getOrientationMatrix()),
+	positionData(positionMatrix.data()),
+	orientationData(orientationMatrix.data()),
+	stride(1),
+	spatialStorageBound(false),
+	taylorOrder(other.taylorOrder)
+{
+}
+
+SpatialEntity & SpatialEntity::operator=(const SpatialEntity & other)
+{
+	if(this != &other)
+	{
+		if(this->spatialStorageBound)
+		{
+			if(other.taylorOrder != this->taylorOrder)
+			{
+				throw std::runtime_error("The Taylor order of a SpatialEntity bound to an external storage cannot change");
+			}
+			this->setSpatial(this->positionData, other.getPositionMatrix());
+			this->setSpatial(this->orientationData, other.getOrientationMatrix());
+		}
+		else
+		{
+			this->taylorOrder = other.taylorOrder;
+			this->positionMatrix = other.getPositionMatrix();
+			this->orientationMatrix = other.getOrientationMatrix();
+			this->positionData = this->positionMatrix.data();
+			this->orientationData = this->orientationMatrix.data();
+		}
+	}
+
+	return *this;
+}
+
 void SpatialEntity::setPosition(const double x, const double y, const double z)
 {
-	this->setSpatial(this->positionMatrix, 0, x, y, z);
+	this->setSpatial(this->positionData, 0, x, y, z);
 }
 
 void SpatialEntity::setPosition(const Vector3D & position)
 {
-	this->setSpatial(this->positionMatrix, 0, position);
+	this->setSpatial(this->positionData, 0, position);
 }
 
 void SpatialEntity::setVelocity(const double u, const double v, const double w)
 {
-	this->setSpatial(this->positionMatrix, 1, u, v, w);
+	this->setSpatial(this->positionData, 1, u, v, w);
 }
 
 void SpatialEntity::setVelocity(const Vector3D & velocity)
 {
-	this->setSpatial(this->positionMatrix, 1, velocity);
+	this->setSpatial(this->positionData, 1, velocity);
 }
 
 void SpatialEntity::setAcceleration(const double x, const double y, const double z)
 {
-	this->setSpatial(this->positionMatrix, 2, x, y, z);
+	this->setSpatial(this->positionData, 2, x, y, z);
 }
 
 void SpatialEntity::setAcceleration(const Vector3D & acceleration)
 {
-	this->setSpatial(this->positionMatrix, 2, acceleration);
+	this->setSpatial(this->positionData, 2, acceleration);
 }
 
 void SpatialEntity::setPositionMatrix(const std::vector<Vector3D> & positionMatrix)
 {
-	this->setSpatial(this->positionMatrix, positionMatrix);
+	this->setSpatial(this->positionData, positionMatrix);
 }
 
 void SpatialEntity::setPositionDerivative(const std::size_t derivative, const double x, const double y, const double z)
 {
-	this->setSpatial(this->positionMatrix, derivative, x, y, z);
+	this->setSpatial(this->positionData, derivative, x, y, z);
 }
 
 void SpatialEntity::setPositionDerivative(const std::size_t derivative, const Vector3D & vec)
 {
-	this->setSpatial(this->positionMatrix, derivative, vec);
+	this->setSpatial(this->positionData, derivative, vec);
 }
 
 Vector3D SpatialEntity::getPosition() const
 {
-	return this->positionMatrix[0];
+	return this->positionData[0];
 }
 
 Vector3D SpatialEntity::getVelocity() const
 {
-	return this->positionMatrix[1];
+	return this->positionData[this->stride];
 }
 
 Vector3D SpatialEntity::getAcceleration() const
 {
-	return this->positionMatrix[2];
+	return this->positionData[2 * this->stride];
 }
 
 std::vector<Vector3D> SpatialEntity::getPositionMatrix(void) const
 {
-	return this->positionMatrix;
+	return this->getSpatial(this->positionData);
 }
 
 Vector3D SpatialEntity::getPositionDerivative(const std::size_t derivative) const
@@ -143,7 +180,7 @@ Vector3D SpatialEntity::getPositionDerivative(const std::size_t derivative) cons
 	}
 	else
 	{
-		return this->positionMatrix[derivative];
+		return this->positionData[derivative * this->stride];
 	}
 }
 
@@ -151,67 +188,67 @@ Vector3D SpatialEntity::getPositionDerivative(const std::size_t derivative) cons
 
 void SpatialEntity::setOrientation(const double x, const double y, const double z)
 {
-	this->setSpatial(this->orientationMatrix, 0, x, y, z);
+	this->setSpatial(this->orientationData, 0, x, y, z);
 }
 
 void SpatialEntity::setOrientation(const Vector3D & orientation)
 {
-	this->setSpatial(this->orientationMatrix, 0, orientation);
+	this->setSpatial(this->orientationData, 0, orientation);
 }
 
 void SpatialEntity::setAngularVelocity(const double x, const double y, const double z)
 {
-	this->setSpatial(this->orientationMatrix, 1, x, y, z);
+	this->setSpatial(this->orientationData, 1, x, y, z);
 }
 
 void SpatialEntity::setAngularVelocity(const Vector3D & angularVelocity)
 {
-	this->setSpatial(this->orientationMatrix, 1, angularVelocity);
+	this->setSpatial(this->orientationData, 1, angularVelocity);
 }
 
 void SpatialEntity::setAngularAcceleration(const double x, const double y, const double z)
 {
-	this->setSpatial(this->orientationMatrix, 2, x, y, z);
+	this->setSpatial(this->orientationData, 2, x, y, z);
 }
 
 void SpatialEntity::setAngularAcceleration(const Vector3D & angularAcceleration)
 {
-	this->setSpatial(this->orientationMatrix, 2, angularAcceleration);
+	this->setSpatial(this->orientationData, 2, angularAcceleration);
 }
 
 void SpatialEntity::setOrientationMatrix(const std::vector<Vector3D> & orientationMatrix)
 {
-	this->setSpatial(this->orientationMatrix, orientationMatrix);
+	this->setSpatial(this->orientationData, orientationMatrix);
 }
 
 void SpatialEntity::setOrientationDerivative(const std::size_t derivative, const double x, const double y, const double z)
 {
-	this->setSpatial(this->orientationMatrix, derivative, x, y, z);
+	this->setSpatial(this->orientationData, derivative, x, y, z);
 }
 
 void SpatialEntity::setOrientationDerivative(const std::size_t derivative, const Vector3D & vec)
 {
-	this->setSpatial(this->orientationMatrix, derivative, vec);
+	this->setSpatial(this->orientationData, derivative, vec);
 }
 
 Vector3D SpatialEntity::getOrientation() const
 {
-	return this->orientationMatrix[0];
+	return this->orientationData[0];
 }
 
 Vector3D SpatialEntity::getAngularVelocity() const
 {
-	return this->orientationMatrix[1];
+	return this->orientationData[this->stride];
 }
 
 Vector3D SpatialEntity::getAngularAcceleration() const
 {
-	return this->orientationMatrix[2];
+	return this->orientationData[2 * this->stride];
 }
 
 std::vector<Vector3D> SpatialEntity::getOrientationMatrix(void) const
 {
-	return this->orientationMatrix;
+	return this->getSpatial(this->orientationData);
 }
 
 Vector3D SpatialEntity::getOrientationDerivative(const std::size_t derivative) const
@@ -222,11 +259,11 @@ Vector3D SpatialEntity::getOrientationDerivative(const std::size_t derivative) c
 	}
 	else
 	{
-		return this->orientationMatrix[derivative];
+		return this->orientationData[derivative * this->stride];
 	}
 }
 
-void SpatialEntity::setSpatial(std::vector<Vector3D> & spatial, const std::size_t derivative, const double x, const double y, const double z)
+void SpatialEntity::setSpatial(Vector3D * spatial, const std::size_t derivative, const double x, const double y, const double z)
 {
 	if(derivative > this->taylorOrder)
 	{
@@ -234,13 +271,13 @@ void SpatialEntity::setSpatial(std::vector<Vector3D> & spatial, const std::size_
 	}
 	else
 	{
-		spatial[derivative].x() = x;
-		spatial[derivative].y() = y;
-		spatial[derivative].z() = z;
+		spatial[derivative * this->stride].x() = x;
+		spatial[derivative * this->stride].y() = y;
+		spatial[derivative * this->stride].z() = z;
 	}
 }
 
-void SpatialEntity::setSpatial(std::vector<Vector3D> & spatial, const std::size_t derivative, const Vector3D & vec)
+void SpatialEntity::setSpatial(Vector3D * spatial, const std::size_t derivative, const Vector3D & vec)
 {
 	if(derivative > this->taylorOrder)
 	{
@@ -248,18 +285,35 @@ void SpatialEntity::setSpatial(std::vector<Vector3D> & spatial, const std::size_
 	}
 	else
 	{
-		spatial[derivative] = vec;
+		spatial[derivative * this->stride] = vec;
 	}
 }
 
-void SpatialEntity::setSpatial(std::vector<Vector3D> & spatialToSet, const std::vector<Vector3D> & spatial)
+void SpatialEntity::setSpatial(Vector3D * spatialToSet, const std::vector<Vector3D> & spatial)
 {
-	spatialToSet = spatial;
-	spatialToSet.resize(this->taylorOrder+1);
+	for(std::size_t derivative = 0; derivative <= this->taylorOrder; ++derivative)
+	{
+		spatialToSet[derivative * this->stride] = derivative < spatial.size() ? spatial[derivative] : Vector3D();
+	}
+}
+
+std::vector<Vector3D> SpatialEntity::getSpatial(const Vector3D * spatial) const
+{
+	std::vector<Vector3D> matrix(this->taylorOrder + 1);
+	for(std::size_t derivative = 0; derivative <= this->taylorOrder; ++derivative)
+	{
+		matrix[derivative] = spatial[derivative * this->stride];
+	}
+	return matrix;
 }
 
 void SpatialEntity::setTaylorOrder(const std::size_t taylorOrder)
 {
+	if(this->spatialStorageBound and taylorOrder != this->taylorOrder)
+	{
+		throw std::runtime_error("The Taylor order of a SpatialEntity bound to an external storage cannot change");
+	}
+
 	this->taylorOrder = taylorOrder;
 	resizePositionOrientation();
 }
@@ -269,11 +323,59 @@ std::size_t SpatialEntity::getTaylorOrder() const
 	return this->taylorOrder;
 }
 
+void SpatialEntity::bindSpatialStorage(Vector3D * position, Vector3D * orientation, const std::size_t stride, const std::size_t maxTaylorOrder)
+{
+	if(this->taylorOrder > maxTaylorOrder)
+	{
+		throw std::runtime_error("External storage cannot hold this SpatialEntity's Taylor order");
+	}
+
+	for(std::size_t derivative = 0; derivative <= maxTaylorOrder; ++derivative)
+	{
+		const bool used = derivative <= this->taylorOrder;
+		position[derivative * stride] = used ? this->positionData[derivative * this->stride] : Vector3D();
+		orientation[derivative * stride] = used ? this->orientationData[derivative * this->stride] : Vector3D();
+	}
+
+	this->positionData = position;
+	this->orientationData = orientation;
+	this->stride = stride;
+	this->spatialStorageBound = true;
+
+	std::vector<Vector3D>().swap(this->positionMatrix);
+	std::vector<Vector3D>().swap(this->orientationMatrix);
+}
+
+void SpatialEntity::unbindSpatialStorage()
+{
+	if(this->spatialStorageBound)
+	{
+		this->positionMatrix = this->getPositionMatrix();
+		this->orientationMatrix = this->getOrientationMatrix();
+
+		this->positionData = this->positionMatrix.data();
+		this->orientationData = this->orientationMatrix.data();
+		this->stride = 1;
+		this->spatialStorageBound = false;
+	}
+}
+
+bool SpatialEntity::isSpatialStorageBound() const
+{
+	return this->spatialStorageBound;
+}
+
 void SpatialEntity::resizePositionOrientation()
 {
-	std::size_t size = taylorOrder + 1;
-	this->positionMatrix.resize(size);
-	this->orientationMatrix.resize(size);
+	if(not this->spatialStorageBound)
+	{
+		std::size_t size = taylorOrder + 1;
+		this->positionMatrix.resize(size);
+		this->orientationMatrix.resize(size);
+
+		this->positionData = this->positionMatrix.data();
+		this->orientationData = this->orientationMatrix.data();
+	}
 }
 
 double distance(const SpatialEntity & left, const SpatialEntity & right)
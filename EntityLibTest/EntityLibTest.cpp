@@ -73,6 +73,19 @@ TestCase(HandledEntity_Test)
 	check(entity4 == entity5);
 }
 
+TestCase(HandlePair_Test)
+{
+	HandledEntity entity1(3);
+	HandledEntity entity2(8);
+
+	const handle_pair pair = makeHandlePair(entity2, entity1);
+
+	checkEqual( pair.first, 3 );
+	checkEqual( pair.second, 8 );
+	check( makeHandlePair(entity1, entity2) == pair );
+	checkEqual( handle_pair_hash()(pair), handle_pair_hash()(makeHandlePair(entity1, entity2)) );
+}
+
 TestCase(SocialEntityBaseClass_Test)
 {
 	int defaultHandle = -1;
@@ -323,19 +336,20 @@ TestCase(SpatialEntityNormalDirectionTest)
 	spatial0.setPosition(position0);
 	spatial1.setPosition(position1);
 
-	checkEqual(spatial0.normalVersor(spatial1), normalVersor);
+	checkEqual(psin::normalVersor(spatial0, spatial1), normalVersor);
 }
 
 TestCase(json_SpatialEntity_Test)
 {
 	json j{
-		{"Position", 
+		{"TaylorOrder", 3},
+		{"PositionMatrix", 
 			{{1.0, 2.0, 3.0},
 			{4.0, 5.0, 6.0},
 			{7.0, 8.0, 9.0},
 			{10.0, 11.0, 12.0}}
 		},
-		{"Orientation", 
+		{"OrientationMatrix", 
 			{{-10.0, -11.0, -12.0},
 			{7.0, 8.0, 9.0},
 			{-4.0, -5.0, -6.0},
@@ -370,7 +384,10 @@ TestCase(json_SpatialEntity_Test)
 	);
 
 	json j2 = spatial;
-	checkEqual(j2, j);
+	SpatialEntity spatial2 = j2;
+
+	checkEqual(spatial2.getPositionMatrix(), position);
+	checkEqual(spatial2.getOrientationMatrix(), orientation);
 }
 
 TestCase(PhysicalEntityInstantiationTest)
@@ -470,43 +487,6 @@ TestCase(PhysicalEntityCallPropertyMemberFunction_Test)
 	checkEqual(physicalEntity.property<A>().f(), returnValue);
 }
 
-namespace PhysicalEntityInputAndOutput_Test_namespace
-{
-	struct TestedProperty : public Property<double>
-	{};
-}
-
-TestCase(PhysicalEntityInputAndOutput_Test)
-{
-	using namespace PhysicalEntityInputAndOutput_Test_namespace;
-
-	double tolerance = 1e-12;
-	double defaultValue = 0.0;
-	double value = 3.14;
-
-	PhysicalEntity<TestedProperty> inputter;
-	PhysicalEntity<TestedProperty> outputter;
-
-	inputter.property<TestedProperty>().set(defaultValue);
-	outputter.property<TestedProperty>().set(value);
-
-	string fileName = "PhysicalEntity_Input_Output_Test.txt";
-	fstream file(fileName, fstream::in | fstream::out | fstream::trunc);
-
-	outputter.output<TestedProperty>(file);
-
-	file.clear();
-	file.seekg(0, ios::beg);
-
-	inputter.input<TestedProperty>(file);
-
-	checkClose(inputter.property<TestedProperty>().get(), value, tolerance);
-
-	file.close();
-
-	std::remove(fileName.c_str());
-}
-
 namespace PhysicalEntity_set__and__get_Test_namespace
 {
 	struct DummyType {};
@@ -690,15 +670,17 @@ TestCase(ParticleMomentumAndEnergyTest)
 TestCase(json_Particle_Test)
 {
 	json j{
+		{"TaylorOrder", 3},
 		{"Name", "Tarintor"},
 		{"Mass", 3791},
-		{"Position", 
+		{"MomentOfInertia", 1286},
+		{"PositionMatrix", 
 			{{1.0, 2.0, 3.0},
 			{4.0, 5.0, 6.0},
 			{7.0, 8.0, 9.0},
 			{10.0, 11.0, 12.0}}
 		},
-		{"Orientation", 
+		{"OrientationMatrix", 
 			{{-10.0, -11.0, -12.0},
 			{7.0, 8.0, 9.0},
 			{-4.0, -5.0, -6.0},
@@ -729,16 +711,13 @@ TestCase(json_Particle_Test)
 
 	json j2 = p;
 
-	json j3 = merge(
-			j,
-			json{
-				{"bodyForce", {0, 0, 0}},
-				{"contactForce", {0, 0, 0}},
-				{"resultingTorque", {0, 0, 0}}
-			}
-		);
+	Particle<> p2 = j2;
 
-	checkEqual(j2, j3);
+	checkEqual(p2.getPositionMatrix(), position);
+	checkEqual(p2.getOrientationMatrix(), orientation);
+	checkEqual(p2.getName(), "Tarintor");
+	checkEqual(p2.get<Mass>(), 3791);
+	checkEqual(p2.getResultingForce(), Vector3D(0, 0, 0));
 }
 
 TestCase(SphericalParticleConstructorsTest)
@@ -1061,10 +1040,12 @@ TestCase(SphericalParticleContactPointTest)
 TestCase(json_SphericalParticle_Test)
 {
 	json j{
+		{"TaylorOrder", 3},
 		{"Name", "Saruman"},
 		{"Mass", 3524},
+		{"MomentOfInertia", 4215},
 		{"Radius", 7108},
-		{"Position",
+		{"PositionMatrix",
 			{
 				{0, 1, 2},
 				{3, 4, 5},
@@ -1072,7 +1053,7 @@ TestCase(json_SphericalParticle_Test)
 				{9, 10, 11}
 			}
 		},
-		{"Orientation",
+		{"OrientationMatrix",
 			{
 				{12, 13, 14},
 				{15, 16, 17},
@@ -1092,16 +1073,13 @@ TestCase(json_SphericalParticle_Test)
 
 	json j2 = sph;
 
-	json j3 = merge(
-			j,
-			json{
-				{"bodyForce", {0, 0, 0}},
-				{"contactForce", {0, 0, 0}},
-				{"resultingTorque", {0, 0, 0}}
-			}
-		);
+	SphericalParticle<> sph2 = j2;
 
-	checkEqual(j2, j3);
+	checkEqual(sph2.getName(), "Saruman");
+	checkEqual(sph2.get<Mass>(), 3524);
+	checkEqual(sph2.get<Radius>(), 7108);
+	checkEqual(sph2.getPosition(), Vector3D(0, 1, 2));
+	checkEqual(sph2.getOrientation(), Vector3D(12, 13, 14));
 }
 
 TestCase(Boundary_Test)
@@ -0,0 +1,57 @@
+#ifndef ASYNC_WRITER_HPP
+#define ASYNC_WRITER_HPP
+
+// Standard
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace psin {
+
+// AsyncWriter runs output tasks on a background thread, one after the other, in the order
+// they were pushed. At most capacity tasks wait in its queue: push() blocks while the queue
+// is full, so that a producer faster than the disk is slowed down instead of piling up memory.
+//
+// An exception thrown by a task is rethrown by the next call to push() or wait().
+class AsyncWriter
+{
+	public:
+		using Task = std::function<void()>;
+
+		explicit AsyncWriter(const std::size_t capacity = 2);
+		~AsyncWriter();
+
+		AsyncWriter(const AsyncWriter &) = delete;
+		AsyncWriter & operator=(const AsyncWriter &) = delete;
+
+		void setCapacity(const std::size_t capacity); // throws
+		std::size_t getCapacity() const;
+
+		void push(Task task); // throws
+		// Blocks until every pushed task has finished
+		void wait(); // throws
+
+	private:
+		void work();
+		void rethrow();
+
+		std::size_t capacity;
+		std::deque<Task> tasks;
+		bool busy = false;
+		bool stopping = false;
+		std::exception_ptr error;
+
+		std::mutex mutex;
+		std::condition_variable taskPushed;
+		std::condition_variable taskPopped;
+
+		std::thread thread;
+};
+
+} // psin
+
+#endif // ASYNC_WRITER_HPP
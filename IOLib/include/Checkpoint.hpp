@@ -0,0 +1,90 @@
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+// UtilsLib
+#include <FileSystem.hpp>
+#include <string.hpp>
+#include <Vector3D.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <cstddef>
+#include <fstream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace psin {
+
+// Checkpoint files hold everything needed to resume a simulation:
+//
+// 	"PSINCHK1"				8 bytes
+// 	uint64 headerSize
+// 	header					headerSize bytes of JSON text
+// 	body					values written one after the other, with no padding
+//
+// The header describes the checkpoint for people; values the simulation must recover exactly
+// belong to the body, which stores numbers bit for bit in the writer's native byte order,
+// given by "ByteOrder". Vectors are stored as their uint64 size followed by their elements.
+namespace checkpoint {
+
+constexpr char magic[] = "PSINCHK1";
+constexpr std::size_t magicSize = 8;
+
+} // checkpoint
+
+// CheckpointWriter writes a checkpoint to a temporary file next to filePath, which commit()
+// renames to filePath. A crash while writing thus leaves the previous checkpoint intact.
+class CheckpointWriter
+{
+	public:
+		CheckpointWriter(const path & filePath, const json & header); // throws
+		~CheckpointWriter();
+
+		CheckpointWriter(const CheckpointWriter &) = delete;
+		CheckpointWriter & operator=(const CheckpointWriter &) = delete;
+
+		template<typename T> void write(const T & value);
+		void write(const Vector3D & vector);
+		template<typename T> void write(const std::vector<T> & values);
+		template<typename T, typename U> void write(const std::pair<T, U> & value);
+		template<typename ... Ts> void write(const std::tuple<Ts...> & value);
+
+		void commit(); // throws
+
+	private:
+		path filePath;
+		path temporaryFilePath;
+		std::ofstream file;
+};
+
+// CheckpointReader reads back, in the same order, the values given to a CheckpointWriter
+class CheckpointReader
+{
+	public:
+		explicit CheckpointReader(const path & filePath); // throws
+
+		const json & getHeader() const;
+
+		// All of them throw if the checkpoint ends before value does
+		template<typename T> void read(T & value);
+		void read(Vector3D & vector);
+		template<typename T> void read(std::vector<T> & values);
+		template<typename T, typename U> void read(std::pair<T, U> & value);
+		template<typename ... Ts> void read(std::tuple<Ts...> & value);
+
+	private:
+		void readBytes(char * bytes, const std::size_t size);
+
+		path filePath;
+		std::ifstream file;
+		json header;
+};
+
+} // psin
+
+#include <Checkpoint.tpp>
+
+#endif // CHECKPOINT_HPP
@@ -0,0 +1,77 @@
+#ifndef CHECKPOINT_TPP
+#define CHECKPOINT_TPP
+
+// Standard
+#include <cstdint>
+#include <type_traits>
+
+namespace psin {
+
+template<typename T>
+void CheckpointWriter::write(const T & value)
+{
+	static_assert(std::is_arithmetic<T>::value, "Only numbers, vectors, pairs and tuples of them can be checkpointed");
+
+	this->file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template<typename T>
+void CheckpointWriter::write(const std::vector<T> & values)
+{
+	this->write( static_cast<std::uint64_t>(values.size()) );
+	for(const T & value : values)
+	{
+		this->write(value);
+	}
+}
+
+template<typename T, typename U>
+void CheckpointWriter::write(const std::pair<T, U> & value)
+{
+	this->write(value.first);
+	this->write(value.second);
+}
+
+template<typename ... Ts>
+void CheckpointWriter::write(const std::tuple<Ts...> & value)
+{
+	std::apply([this](const Ts & ... elements){ (this->write(elements), ...); }, value);
+}
+
+template<typename T>
+void CheckpointReader::read(T & value)
+{
+	static_assert(std::is_arithmetic<T>::value, "Only numbers, vectors, pairs and tuples of them can be checkpointed");
+
+	this->readBytes(reinterpret_cast<char *>(&value), sizeof(value));
+}
+
+template<typename T>
+void CheckpointReader::read(std::vector<T> & values)
+{
+	std::uint64_t size = 0;
+	this->read(size);
+
+	values.resize(size);
+	for(T & value : values)
+	{
+		this->read(value);
+	}
+}
+
+template<typename T, typename U>
+void CheckpointReader::read(std::pair<T, U> & value)
+{
+	this->read(value.first);
+	this->read(value.second);
+}
+
+template<typename ... Ts>
+void CheckpointReader::read(std::tuple<Ts...> & value)
+{
+	std::apply([this](Ts & ... elements){ (this->read(elements), ...); }, value);
+}
+
+} // psin
+
+#endif // CHECKPOINT_TPP
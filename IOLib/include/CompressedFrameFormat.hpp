@@ -0,0 +1,37 @@
+#ifndef COMPRESSED_FRAME_FORMAT_HPP
+#define COMPRESSED_FRAME_FORMAT_HPP
+
+// IOLib
+#include <FrameFormat.hpp>
+
+// Standard
+#include <cstddef>
+
+namespace psin {
+
+// Compressed frame files store the same frames as frame files (see FrameFormat.hpp), each one
+// encoded by a DeltaCodec against the frame before it:
+//
+// 	"PSINDLT1"				8 bytes
+// 	uint64 headerSize
+// 	header					headerSize bytes of JSON text
+// 	records, each one being
+// 		uint64 encodingBytes
+// 		uint8 keyframe			1 if the frame was encoded as if it were the first one
+// 		int64 timeIndex
+// 		float64 timeInstant
+// 		encodingBytes bytes of the frame's encoding, without timeIndex and timeInstant
+//
+// The header's "Entities" list each entity's fields, whose "Tolerance" is the codec's tolerance for
+// their values. Every "KeyframeInterval"-th record is a keyframe, from which decoding may start.
+namespace compressedframe {
+
+constexpr char magic[] = "PSINDLT1";
+constexpr std::size_t magicSize = 8;
+constexpr std::size_t recordHeaderBytes = 8 + 1 + 8 + 8;
+
+} // compressedframe
+
+} // psin
+
+#endif // COMPRESSED_FRAME_FORMAT_HPP
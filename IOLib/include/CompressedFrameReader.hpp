@@ -0,0 +1,69 @@
+#ifndef COMPRESSED_FRAME_READER_HPP
+#define COMPRESSED_FRAME_READER_HPP
+
+// IOLib
+#include <CompressedFrameFormat.hpp>
+#include <DeltaCodec.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// Standard
+#include <fstream>
+#include <ios>
+#include <vector>
+
+namespace psin {
+
+// CompressedFrameReader rebuilds the frames of a compressed frame file (see CompressedFrameFormat.hpp).
+// Opening a file reads its header and the header of each record. A frame is decoded starting from
+// the last keyframe before it, so reading frames in increasing order decodes each one only once.
+class CompressedFrameReader
+{
+	public:
+		explicit CompressedFrameReader(const path & filePath); // throws
+
+		const json & getHeader() const;
+		const std::vector<FrameEntity> & getEntities() const;
+		// Position of the entity called name in getEntities(). Throws if there is none.
+		std::size_t getEntityIndex(const string & name) const;
+
+		std::size_t getFrameSize() const;
+		std::size_t getNumberOfFrames() const;
+
+		// Position of the entity's field's first value in a frame. Throws if there is no such field.
+		std::size_t getFieldOffset(const std::size_t entity, const string & field) const;
+
+		// Every value in the frame, starting with timeIndex and timeInstant
+		std::vector<double> readFrame(const std::size_t frame); // throws
+
+		// First frame whose timeIndex (or timeInstant) is not less than the argument, or getNumberOfFrames()
+		// if there is none
+		std::size_t findTimeIndex(const long timeIndex) const;
+		std::size_t findTime(const double time) const;
+
+	private:
+		struct Record
+		{
+			std::streamoff offset;	// of the record's encoding
+			std::size_t encodingBytes;
+			bool keyframe;
+			long timeIndex;
+			double time;
+		};
+
+		std::ifstream file;
+		json header;
+		std::vector<FrameEntity> entities;
+		std::vector<std::size_t> entityOffsets;	// of each entity's first value in a frame
+		std::vector<Record> records;
+
+		DeltaCodec codec;
+		std::vector<double> frame;			// last decoded frame, without timeIndex and timeInstant
+		std::size_t decodedFrame;			// index of frame, or getNumberOfFrames() if none
+		std::vector<char> encoding;
+};
+
+} // psin
+
+#endif // COMPRESSED_FRAME_READER_HPP
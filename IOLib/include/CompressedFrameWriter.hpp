@@ -0,0 +1,50 @@
+#ifndef COMPRESSED_FRAME_WRITER_HPP
+#define COMPRESSED_FRAME_WRITER_HPP
+
+// IOLib
+#include <CompressedFrameFormat.hpp>
+#include <DeltaCodec.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// Standard
+#include <fstream>
+#include <vector>
+
+namespace psin {
+
+// CompressedFrameWriter appends frames to a compressed frame file (see CompressedFrameFormat.hpp).
+// Each frame is written when it is appended.
+class CompressedFrameWriter
+{
+	public:
+		constexpr static std::size_t defaultKeyframeInterval = 100;
+
+		CompressedFrameWriter() = default;
+		~CompressedFrameWriter();
+
+		// Entries of description are copied into the header
+		void open(const path & filePath, const std::vector<FrameEntity> & entities, const std::size_t keyframeInterval = defaultKeyframeInterval, const json & description = json::object()); // throws
+		bool isOpen() const;
+
+		// Number of values in a frame, including timeIndex and timeInstant
+		std::size_t getFrameSize() const;
+
+		// values holds getFrameSize() - 2 doubles, laid out as the entities given to open()
+		void append(const long timeIndex, const double time, const double * values); // throws
+
+		void flush();
+		void close();
+
+	private:
+		std::ofstream file;
+		DeltaCodec codec;
+		std::size_t keyframeInterval = defaultKeyframeInterval;
+		std::size_t numberOfFrames = 0;
+		std::vector<char> encoding;
+};
+
+} // psin
+
+#endif // COMPRESSED_FRAME_WRITER_HPP
@@ -0,0 +1,48 @@
+#ifndef DELTA_CODEC_HPP
+#define DELTA_CODEC_HPP
+
+// Standard
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace psin {
+
+// DeltaCodec encodes a sequence of frames, each one made of the same number of values, against
+// the frame before it, so that values that did not change take almost no room.
+//
+// Each value is first turned into a 64-bit word:
+// 	a value with a tolerance is quantized to the nearest multiple of 2 * tolerance, whose
+// 		factor is the word, so that it is rebuilt with an error of at most the tolerance;
+// 	any other value's word is its bit pattern, so that it is rebuilt exactly.
+// A quantized word is then stored as its difference to the previous frame's word, and a bit
+// pattern as its exclusive or with it. Both are zero for an unchanged value.
+//
+// Differences are written as variable-length integers (7 bits per byte, least significant
+// first, zigzag-encoded when signed). A zero starts a run of unchanged values and is followed
+// by the number of unchanged values after it.
+class DeltaCodec
+{
+	public:
+		DeltaCodec() = default;
+		// One tolerance per value of a frame
+		explicit DeltaCodec(const std::vector<double> & tolerances); // throws
+
+		std::size_t getFrameSize() const;
+
+		// The next frame is encoded or decoded as if it were the first one
+		void reset();
+
+		// Appends frame's encoding to bytes. Throws if a value is too large to be quantized.
+		void encode(const double * frame, std::vector<char> & bytes); // throws
+		// Rebuilds a frame from bytes in [begin, end), returning where its encoding ends
+		const char * decode(const char * begin, const char * end, double * frame); // throws
+
+	private:
+		std::vector<double> steps;	// 0 for exact values
+		std::vector<std::uint64_t> previous;
+};
+
+} // psin
+
+#endif // DELTA_CODEC_HPP
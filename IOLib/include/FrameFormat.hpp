@@ -0,0 +1,46 @@
+#ifndef FRAME_FORMAT_HPP
+#define FRAME_FORMAT_HPP
+
+// IOLib
+#include <TrajectoryFormat.hpp>
+
+// Standard
+#include <cstddef>
+#include <vector>
+
+namespace psin {
+
+// Frame files store the states of many entities in a single file, one frame per stored time:
+//
+// 	"PSINFRM1"				8 bytes
+// 	uint64 headerSize
+// 	header					headerSize bytes of JSON text
+// 	frames of FrameBytes bytes each
+//
+// A frame starts with the float64 values "timeIndex" and "timeInstant", followed by one record
+// per entity, in the order of the header's "Entities". Each entity lists the fields of its record
+// under "Fields", as trajectory files do (see TrajectoryFormat.hpp). The number of values in a
+// frame is given by "FrameSize".
+//
+// All frames have the same size, so the n-th frame starts n * FrameBytes bytes after the header:
+// a whole frame is read at once, and an entity's state in any frame with a single seek.
+namespace frame {
+
+constexpr char magic[] = "PSINFRM1";
+constexpr std::size_t magicSize = 8;
+
+} // frame
+
+struct FrameEntity
+{
+	string name;
+	std::vector<TrajectoryField> fields;
+	json description = json::object();	// copied into the entity's header entry
+};
+
+void to_json(json & j, const FrameEntity & entity);
+void from_json(const json & j, FrameEntity & entity);
+
+} // psin
+
+#endif // FRAME_FORMAT_HPP
@@ -0,0 +1,65 @@
+#ifndef FRAME_READER_HPP
+#define FRAME_READER_HPP
+
+// IOLib
+#include <FrameFormat.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// Standard
+#include <fstream>
+#include <ios>
+#include <vector>
+
+namespace psin {
+
+// FrameReader gives random access to the frames of a frame file (see FrameFormat.hpp), both
+// a frame at a time, to get every entity at a given time, and an entity at a time, to follow it
+// through the frames. Opening a file only reads its header.
+class FrameReader
+{
+	public:
+		explicit FrameReader(const path & filePath); // throws
+
+		const json & getHeader() const;
+		const std::vector<FrameEntity> & getEntities() const;
+		// Position of the entity called name in getEntities(). Throws if there is none.
+		std::size_t getEntityIndex(const string & name) const;
+
+		std::size_t getFrameSize() const;
+		std::size_t getFrameBytes() const;
+		std::size_t getNumberOfFrames() const;
+
+		// Position of the entity's field's first value in a frame. Throws if there is no such field.
+		std::size_t getFieldOffset(const std::size_t entity, const string & field) const;
+
+		// Every value in the frame, starting with timeIndex and timeInstant
+		std::vector<double> readFrame(const std::size_t frame);
+
+		// Values of the entity's field in frames [firstFrame, lastFrame), frame after frame
+		std::vector<double> readField(const std::size_t entity, const string & field, const std::size_t firstFrame, const std::size_t lastFrame);
+
+		// First frame whose timeIndex (or timeInstant) is not less than the argument, or getNumberOfFrames()
+		// if there is none
+		std::size_t findTimeIndex(const long timeIndex);
+		std::size_t findTime(const double time);
+
+	private:
+		std::streamoff offsetOf(const std::size_t frame) const;
+		double readValue(const std::size_t frame, const std::size_t offset);
+		template<typename Compare>
+		std::size_t lowerBound(const std::size_t offset, Compare && isBefore);
+
+		std::ifstream file;
+		json header;
+		std::vector<FrameEntity> entities;
+		std::vector<std::size_t> entityOffsets;	// of each entity's first value in a frame
+		RecordLayout layout;
+		std::streamoff firstFrameOffset;
+		std::size_t numberOfFrames = 0;
+};
+
+} // psin
+
+#endif // FRAME_READER_HPP
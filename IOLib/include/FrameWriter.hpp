@@ -0,0 +1,51 @@
+#ifndef FRAME_WRITER_HPP
+#define FRAME_WRITER_HPP
+
+// IOLib
+#include <FrameFormat.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// Standard
+#include <fstream>
+#include <vector>
+
+namespace psin {
+
+// FrameWriter appends frames to a frame file (see FrameFormat.hpp). Whatever the number of
+// entities, it keeps a single file open.
+class FrameWriter
+{
+	public:
+		FrameWriter() = default;
+
+		// Entries of description are copied into the header
+		FrameWriter(const path & filePath, const std::vector<FrameEntity> & entities, const json & description = json::object()); // throws
+		~FrameWriter();
+
+		FrameWriter(FrameWriter &&) = default;
+		FrameWriter & operator=(FrameWriter &&) = default;
+
+		void open(const path & filePath, const std::vector<FrameEntity> & entities, const json & description = json::object()); // throws
+		bool isOpen() const;
+
+		// Number of values in a frame, including timeIndex and timeInstant
+		std::size_t getFrameSize() const;
+		std::size_t getFrameBytes() const;
+
+		// values holds getFrameSize() - 2 doubles: the values of each entity's fields, entity after entity
+		void append(const long timeIndex, const double time, const double * values);
+
+		void flush();
+		void close();
+
+	private:
+		std::ofstream file;
+		RecordLayout layout;
+		std::vector<char> frame;
+};
+
+} // psin
+
+#endif // FRAME_WRITER_HPP
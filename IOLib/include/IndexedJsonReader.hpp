@@ -0,0 +1,43 @@
+#ifndef INDEXED_JSON_READER_HPP
+#define INDEXED_JSON_READER_HPP
+
+// IOLib
+#include <TimeIndexReader.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <fstream>
+
+namespace psin {
+
+// IndexedJsonReader reads single entries of a JSON output stream, such as a particle's output
+// file, through its time index: an entry is found with a binary search over the index and parsed
+// on its own, without reading the entries before it.
+class IndexedJsonReader
+{
+	public:
+		// Opens the stream and timeindex::indexPathOf(streamPath)
+		explicit IndexedJsonReader(const path & streamPath); // throws
+
+		TimeIndexReader & getIndex();
+		std::size_t getNumberOfEntries() const;
+
+		json readEntry(const std::size_t entry); // throws
+
+		// Entry stored at timeIndex, or at the first time not before time. Both throw if there is none.
+		json readAtTimeIndex(const long timeIndex);
+		json readAtTime(const double time);
+
+	private:
+		std::ifstream file;
+		TimeIndexReader index;
+};
+
+} // psin
+
+#endif // INDEXED_JSON_READER_HPP
@@ -0,0 +1,37 @@
+#ifndef JSON_LINES_READER_HPP
+#define JSON_LINES_READER_HPP
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <fstream>
+#include <ios>
+#include <vector>
+
+namespace psin {
+
+// JsonLinesReader follows a JSON Lines output file, which holds one entry per line, while it is
+// being written. Each call to readAvailable() returns the entries completed since the previous
+// call: a last line that is still being written, or that was cut short by a crash, is left for later.
+class JsonLinesReader
+{
+	public:
+		explicit JsonLinesReader(const path & filePath); // throws
+
+		// Throws if a complete line is not valid JSON
+		std::vector<json> readAvailable();
+		std::size_t getNumberOfEntriesRead() const;
+
+	private:
+		std::ifstream file;
+		std::streamoff offset = 0;
+		std::size_t numberOfEntriesRead = 0;
+};
+
+} // psin
+
+#endif // JSON_LINES_READER_HPP
@@ -0,0 +1,44 @@
+#ifndef OUTPUT_BUFFER_HPP
+#define OUTPUT_BUFFER_HPP
+
+// Standard
+#include <cstddef>
+#include <vector>
+
+namespace psin {
+
+// OutputBuffer holds output frames until they are written. A frame is a flat record of doubles
+// with the state of every entity at one stored time, laid out by whoever produces it.
+// The buffer tracks the memory taken by its frames and reports when it reaches a byte budget,
+// so that frames are written out and dropped before they can pile up.
+class OutputBuffer
+{
+	public:
+		using Frame = std::vector<double>;
+
+		constexpr static std::size_t defaultByteBudget = 64 * 1024 * 1024;
+
+		explicit OutputBuffer(const std::size_t byteBudget = defaultByteBudget);
+
+		void setByteBudget(const std::size_t byteBudget); // throws
+		std::size_t getByteBudget() const;
+
+		void append(Frame && frame);
+		const std::vector<Frame> & getFrames() const;
+		bool empty() const;
+
+		// Bytes taken by the frames' values
+		std::size_t getSize() const;
+		bool isFull() const;
+
+		void clear();
+
+	private:
+		std::size_t byteBudget;
+		std::size_t size = 0;
+		std::vector<Frame> frames;
+};
+
+} // psin
+
+#endif // OUTPUT_BUFFER_HPP
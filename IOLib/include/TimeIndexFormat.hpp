@@ -0,0 +1,44 @@
+#ifndef TIME_INDEX_FORMAT_HPP
+#define TIME_INDEX_FORMAT_HPP
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// Standard
+#include <cstddef>
+#include <cstdint>
+
+namespace psin {
+
+// A time index file sits next to a JSON output stream (such as timeVector.json or a particle's
+// output file), which is an array with an entry per stored time, and tells where each entry starts:
+//
+// 	"PSINIDX1"				8 bytes
+// 	uint64 headerSize
+// 	header					headerSize bytes of JSON text
+// 	entries of EntryBytes bytes each, one per entry of the stream, in the same order:
+// 		uint64 timeIndex
+// 		float64 timeInstant
+// 		uint64 offset		of the entry's first byte in the stream
+//
+// Numbers are stored in the writer's native byte order, given by "ByteOrder".
+namespace timeindex {
+
+constexpr char magic[] = "PSINIDX1";
+constexpr std::size_t magicSize = 8;
+
+// The index of the stream at streamPath: streamPath with ".index" appended
+path indexPathOf(const path & streamPath);
+
+} // timeindex
+
+struct TimeIndexEntry
+{
+	std::uint64_t timeIndex;
+	double timeInstant;
+	std::uint64_t offset;
+};
+
+} // psin
+
+#endif // TIME_INDEX_FORMAT_HPP
@@ -0,0 +1,49 @@
+#ifndef TIME_INDEX_READER_HPP
+#define TIME_INDEX_READER_HPP
+
+// IOLib
+#include <TimeIndexFormat.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <fstream>
+#include <ios>
+
+namespace psin {
+
+// TimeIndexReader reads the entries of a time index file (see TimeIndexFormat.hpp) from disk
+// when they are requested, so that opening an index costs the same whatever its size.
+class TimeIndexReader
+{
+	public:
+		explicit TimeIndexReader(const path & filePath); // throws
+
+		const json & getHeader() const;
+		std::size_t getNumberOfEntries() const;
+
+		TimeIndexEntry getEntry(const std::size_t entry); // throws
+
+		// First entry whose timeIndex (or timeInstant) is not less than the argument, or
+		// getNumberOfEntries() if there is none. This is a binary search over the file.
+		std::size_t findTimeIndex(const long timeIndex);
+		std::size_t findTime(const double time);
+
+	private:
+		template<typename Compare>
+		std::size_t lowerBound(Compare && isBefore);
+
+		std::ifstream file;
+		json header;
+		std::streamoff firstEntryOffset = 0;
+		std::size_t entryBytes = 0;
+		std::size_t numberOfEntries = 0;
+};
+
+} // psin
+
+#endif // TIME_INDEX_READER_HPP
@@ -0,0 +1,47 @@
+#ifndef TIME_INDEX_WRITER_HPP
+#define TIME_INDEX_WRITER_HPP
+
+// IOLib
+#include <TimeIndexFormat.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <fstream>
+#include <ostream>
+
+namespace psin {
+
+// TimeIndexWriter appends entries to a time index file (see TimeIndexFormat.hpp)
+class TimeIndexWriter
+{
+	public:
+		TimeIndexWriter() = default;
+		~TimeIndexWriter();
+
+		TimeIndexWriter(TimeIndexWriter &&) = default;
+		TimeIndexWriter & operator=(TimeIndexWriter &&) = default;
+
+		// Entries of description are copied into the header
+		void open(const path & filePath, const json & description = json::object()); // throws
+		bool isOpen() const;
+
+		void append(const long timeIndex, const double time, const std::uint64_t offset);
+		// Indexes the entry about to be written to stream, at its current position
+		void append(const long timeIndex, const double time, std::ostream & stream);
+
+		// The stream should be flushed first, so that the index never points past its end
+		void flush();
+		void close();
+
+	private:
+		std::ofstream file;
+};
+
+} // psin
+
+#endif // TIME_INDEX_WRITER_HPP
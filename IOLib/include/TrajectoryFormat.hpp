@@ -0,0 +1,90 @@
+#ifndef TRAJECTORY_FORMAT_HPP
+#define TRAJECTORY_FORMAT_HPP
+
+// UtilsLib
+#include <string.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace psin {
+
+// Binary trajectory files store one entity's states as fixed-layout records:
+//
+// 	"PSINTRJ1"				8 bytes
+// 	uint64 headerSize
+// 	header					headerSize bytes of JSON text
+// 	chunks, each one being
+// 		uint64 numberOfRecords
+// 		numberOfRecords records of RecordBytes bytes
+//
+// The header lists the record's fields in order, under "Fields", the number of values in a
+// record, under "RecordSize", and its number of bytes, under "RecordBytes". Each field's values
+// are stored as its "Type", either "float64" or "float32"; fields without a type are float64.
+// Every record starts with the float64 fields "timeIndex" and "timeInstant", named as in the JSON output.
+// Numbers are stored in the writer's native byte order, given by "ByteOrder".
+namespace trajectory {
+
+constexpr char magic[] = "PSINTRJ1";
+constexpr std::size_t magicSize = 8;
+
+const string timeIndexField = "timeIndex";
+const string timeField = "timeInstant";
+
+const string float64Type = "float64";
+const string float32Type = "float32";
+
+// Bytes taken by a value of the given type. Throws if the type is unknown.
+std::size_t valueSize(const string & type);
+
+// "little" or "big"
+string nativeByteOrder();
+
+} // trajectory
+
+struct TrajectoryField
+{
+	string name;
+	std::size_t components;
+	string type = trajectory::float64Type;
+	// Largest error allowed by formats that quantize values (see DeltaCodec.hpp), or 0 to store
+	// values exactly. It is written to headers as "Tolerance" only when it is not 0.
+	double tolerance = 0.0;
+};
+
+void to_json(json & j, const TrajectoryField & field);
+void from_json(const json & j, TrajectoryField & field);
+
+// RecordLayout maps the values of a record made of the given fields to their place and type in its bytes
+class RecordLayout
+{
+	public:
+		RecordLayout() = default;
+		explicit RecordLayout(const std::vector<TrajectoryField> & fields); // throws
+
+		// Number of values in a record
+		std::size_t getSize() const;
+		std::size_t getBytes() const;
+
+		std::size_t getByteOffset(const std::size_t value) const;
+		std::size_t getValueBytes(const std::size_t value) const;
+
+		void encode(const std::size_t value, const double x, char * record) const;
+		double decode(const char * record, const std::size_t value) const;
+		// Same as decode, from a pointer to the value's own bytes
+		double decodeValue(const char * bytes, const std::size_t value) const;
+
+	private:
+		std::size_t bytes = 0;
+		std::vector<std::size_t> byteOffsets;
+		std::vector<bool> singlePrecision;
+};
+
+} // psin
+
+#endif // TRAJECTORY_FORMAT_HPP
@@ -0,0 +1,68 @@
+#ifndef TRAJECTORY_READER_HPP
+#define TRAJECTORY_READER_HPP
+
+// IOLib
+#include <TrajectoryFormat.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// Standard
+#include <fstream>
+#include <ios>
+#include <vector>
+
+namespace psin {
+
+// TrajectoryReader gives random access to the records of a binary trajectory file (see
+// TrajectoryFormat.hpp). Opening a file reads its header and the size of each chunk, and
+// nothing else: records are read from disk only when requested.
+class TrajectoryReader
+{
+	public:
+		explicit TrajectoryReader(const path & filePath); // throws
+
+		const json & getHeader() const;
+		const std::vector<TrajectoryField> & getFields() const;
+		std::size_t getRecordSize() const;
+		std::size_t getRecordBytes() const;
+		std::size_t getNumberOfRecords() const;
+
+		// Position of field's first component in a record. Throws if there is no such field.
+		std::size_t getFieldOffset(const string & field) const;
+
+		// Values are returned as double whatever their type in the file
+		std::vector<double> readRecord(const std::size_t record);
+
+		// Values of field in records [firstRecord, lastRecord), record after record
+		std::vector<double> readField(const string & field, const std::size_t firstRecord, const std::size_t lastRecord);
+
+		// First record whose timeIndex (or timeInstant) is not less than the argument, or getNumberOfRecords()
+		// if there is none. Records are stored in increasing time order, so this is a binary search.
+		std::size_t findTimeIndex(const long timeIndex);
+		std::size_t findTime(const double time);
+
+	private:
+		struct Chunk
+		{
+			std::streamoff offset;	// of the chunk's first record
+			std::size_t firstRecord;
+			std::size_t numberOfRecords;
+		};
+
+		std::streamoff offsetOf(const std::size_t record) const;
+		double readValue(const std::size_t record, const std::size_t offset);
+		template<typename Compare>
+		std::size_t lowerBound(const std::size_t offset, Compare && isBefore);
+
+		std::ifstream file;
+		json header;
+		std::vector<TrajectoryField> fields;
+		RecordLayout layout;
+		std::size_t numberOfRecords = 0;
+		std::vector<Chunk> chunks;
+};
+
+} // psin
+
+#endif // TRAJECTORY_READER_HPP
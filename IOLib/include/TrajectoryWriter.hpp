@@ -0,0 +1,54 @@
+#ifndef TRAJECTORY_WRITER_HPP
+#define TRAJECTORY_WRITER_HPP
+
+// IOLib
+#include <TrajectoryFormat.hpp>
+
+// UtilsLib
+#include <FileSystem.hpp>
+
+// Standard
+#include <fstream>
+#include <vector>
+
+namespace psin {
+
+// TrajectoryWriter appends records to a binary trajectory file (see TrajectoryFormat.hpp).
+// Records are kept in memory until flush(), which writes them as a single chunk.
+// Values of float32 fields are rounded to float when appended.
+class TrajectoryWriter
+{
+	public:
+		TrajectoryWriter() = default;
+
+		// fields must not include timeIndex and timeInstant, which are added in front of them.
+		// Entries of description are copied into the header.
+		TrajectoryWriter(const path & filePath, const std::vector<TrajectoryField> & fields, const json & description = json::object()); // throws
+		~TrajectoryWriter();
+
+		TrajectoryWriter(TrajectoryWriter &&) = default;
+		TrajectoryWriter & operator=(TrajectoryWriter &&) = default;
+
+		void open(const path & filePath, const std::vector<TrajectoryField> & fields, const json & description = json::object()); // throws
+		bool isOpen() const;
+
+		// Number of values in a record, including timeIndex and timeInstant
+		std::size_t getRecordSize() const;
+		std::size_t getRecordBytes() const;
+		std::size_t getNumberOfBufferedRecords() const;
+
+		// values holds getRecordSize() - 2 doubles, laid out as the fields given to open()
+		void append(const long timeIndex, const double time, const double * values);
+
+		void flush();
+		void close();
+
+	private:
+		std::ofstream file;
+		RecordLayout layout;
+		std::vector<char> chunk;
+};
+
+} // psin
+
+#endif // TRAJECTORY_WRITER_HPP
@@ -0,0 +1,64 @@
+#ifndef VTK_WRITER_HPP
+#define VTK_WRITER_HPP
+
+// UtilsLib
+#include <FileSystem.hpp>
+#include <string.hpp>
+
+// Standard
+#include <cstddef>
+#include <vector>
+
+namespace psin {
+
+// VTK files are written in VTK's XML format, which ParaView opens directly:
+// 	.vtu files hold an unstructured grid, whose arrays are stored as raw binary appended data
+// 	.pvd files list the .vtu files of a time series, each one with its time
+namespace vtk {
+
+// A named array with components values per point or per cell, one point or cell after the other
+struct DataArray
+{
+	string name;
+	std::size_t components;
+	std::vector<double> values;
+};
+
+// points holds the 3 coordinates of each point. Every point is a vertex cell, so that ParaView
+// shows them as a point cloud.
+void writePointCloud(const path & filePath, const std::vector<double> & points, const std::vector<DataArray> & pointData); // throws
+
+// Each polygon lists its points' indices, in order around it
+void writePolygons(const path & filePath, const std::vector<double> & points, const std::vector< std::vector<std::size_t> > & polygons, const std::vector<DataArray> & cellData); // throws
+
+} // vtk
+
+// VtkSeriesWriter keeps the .pvd file of a time series of .vtu files up to date
+class VtkSeriesWriter
+{
+	public:
+		void open(const path & filePath);
+		bool isOpen() const;
+
+		// dataSetPath is relative to the .pvd file's directory
+		void add(const double time, const path & dataSetPath);
+
+		// Rewrites the .pvd file with every data set added so far
+		void flush(); // throws
+		void close(); // throws
+
+	private:
+		struct DataSet
+		{
+			double time;
+			path filePath;
+		};
+
+		path filePath;
+		std::vector<DataSet> dataSets;
+		bool opened = false;
+};
+
+} // psin
+
+#endif // VTK_WRITER_HPP
@@ -0,0 +1,108 @@
+#include <AsyncWriter.hpp>
+
+// Standard
+#include <stdexcept>
+
+namespace psin {
+
+AsyncWriter::AsyncWriter(const std::size_t capacity)
+{
+	this->setCapacity(capacity);
+	this->thread = std::thread(&AsyncWriter::work, this);
+}
+
+AsyncWriter::~AsyncWriter()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->stopping = true;
+	}
+	this->taskPushed.notify_one();
+	this->thread.join();
+}
+
+void AsyncWriter::setCapacity(const std::size_t capacity)
+{
+	if(capacity == 0)
+	{
+		throw std::runtime_error("The output queue capacity must be positive.");
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->capacity = capacity;
+}
+
+std::size_t AsyncWriter::getCapacity() const
+{
+	return this->capacity;
+}
+
+void AsyncWriter::push(Task task)
+{
+	{
+		std::unique_lock<std::mutex> lock(this->mutex);
+		this->taskPopped.wait(lock, [this]{ return this->tasks.size() < this->capacity or this->error; });
+		this->rethrow();
+
+		this->tasks.push_back(std::move(task));
+	}
+	this->taskPushed.notify_one();
+}
+
+void AsyncWriter::wait()
+{
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->taskPopped.wait(lock, [this]{ return (this->tasks.empty() and not this->busy) or this->error; });
+	this->rethrow();
+}
+
+// Must be called with the mutex locked
+void AsyncWriter::rethrow()
+{
+	if(this->error)
+	{
+		std::exception_ptr error = this->error;
+		this->error = nullptr;
+		this->tasks.clear();
+		std::rethrow_exception(error);
+	}
+}
+
+// The queue is drained before stopping, so that no output is lost
+void AsyncWriter::work()
+{
+	while(true)
+	{
+		Task task;
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->taskPushed.wait(lock, [this]{ return this->stopping or not this->tasks.empty(); });
+
+			if(this->tasks.empty()) return;
+
+			task = std::move(this->tasks.front());
+			this->tasks.pop_front();
+			this->busy = true;
+		}
+		this->taskPopped.notify_all();
+
+		std::exception_ptr error;
+		try
+		{
+			task();
+		}
+		catch(...)
+		{
+			error = std::current_exception();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->busy = false;
+			if(error and not this->error) this->error = error;
+		}
+		this->taskPopped.notify_all();
+	}
+}
+
+} // psin
@@ -0,0 +1,111 @@
+#include <Checkpoint.hpp>
+
+// IOLib
+#include <TrajectoryFormat.hpp>
+
+// Standard
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace psin {
+
+CheckpointWriter::CheckpointWriter(const path & filePath, const json & header)
+	: filePath(filePath),
+	temporaryFilePath(filePath.string() + ".tmp")
+{
+	json fullHeader = header;
+	fullHeader["ByteOrder"] = trajectory::nativeByteOrder();
+	const string headerText = fullHeader.dump();
+	const std::uint64_t headerSize = headerText.size();
+
+	this->file.open(this->temporaryFilePath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open checkpoint file " + this->temporaryFilePath.string());
+	}
+
+	this->file.write(checkpoint::magic, checkpoint::magicSize);
+	this->file.write(reinterpret_cast<const char *>(&headerSize), sizeof(headerSize));
+	this->file.write(headerText.data(), headerText.size());
+}
+
+// An uncommitted checkpoint is discarded
+CheckpointWriter::~CheckpointWriter()
+{
+	if(this->file.is_open())
+	{
+		this->file.close();
+		boost::system::error_code error;
+		filesystem::remove(this->temporaryFilePath, error);
+	}
+}
+
+void CheckpointWriter::write(const Vector3D & vector)
+{
+	this->write(vector.x());
+	this->write(vector.y());
+	this->write(vector.z());
+}
+
+void CheckpointWriter::commit()
+{
+	this->file.close();
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not write checkpoint file " + this->temporaryFilePath.string());
+	}
+
+	filesystem::rename(this->temporaryFilePath, this->filePath);
+}
+
+CheckpointReader::CheckpointReader(const path & filePath)
+	: filePath(filePath),
+	file(filePath.string(), std::ios::in | std::ios::binary)
+{
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open checkpoint file " + filePath.string());
+	}
+
+	char magic[checkpoint::magicSize];
+	std::uint64_t headerSize = 0;
+	this->file.read(magic, checkpoint::magicSize);
+	this->file.read(reinterpret_cast<char *>(&headerSize), sizeof(headerSize));
+	if(not this->file or std::memcmp(magic, checkpoint::magic, checkpoint::magicSize) != 0)
+	{
+		throw std::runtime_error(filePath.string() + " is not a checkpoint file");
+	}
+
+	string headerText(headerSize, '\0');
+	this->readBytes(&headerText[0], headerSize);
+	this->header = json::parse(headerText);
+
+	if(this->header.at("ByteOrder") != trajectory::nativeByteOrder())
+	{
+		throw std::runtime_error(filePath.string() + " was written with another byte order");
+	}
+}
+
+const json & CheckpointReader::getHeader() const
+{
+	return this->header;
+}
+
+void CheckpointReader::read(Vector3D & vector)
+{
+	this->read(vector.x());
+	this->read(vector.y());
+	this->read(vector.z());
+}
+
+void CheckpointReader::readBytes(char * bytes, const std::size_t size)
+{
+	this->file.read(bytes, size);
+	if(not this->file)
+	{
+		throw std::runtime_error("Checkpoint file " + this->filePath.string() + " is truncated");
+	}
+}
+
+} // psin
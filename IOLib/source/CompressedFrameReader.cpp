@@ -0,0 +1,183 @@
+#include <CompressedFrameReader.hpp>
+
+// Standard
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace psin {
+
+CompressedFrameReader::CompressedFrameReader(const path & filePath)
+	: file(filePath.string(), std::ios::in | std::ios::binary)
+{
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open compressed frame file " + filePath.string());
+	}
+
+	char magic[compressedframe::magicSize];
+	std::uint64_t headerSize = 0;
+	this->file.read(magic, compressedframe::magicSize);
+	this->file.read(reinterpret_cast<char *>(&headerSize), sizeof(headerSize));
+	if(not this->file or std::memcmp(magic, compressedframe::magic, compressedframe::magicSize) != 0)
+	{
+		throw std::runtime_error(filePath.string() + " is not a compressed frame file");
+	}
+
+	string headerText(headerSize, '\0');
+	this->file.read(&headerText[0], headerSize);
+	this->header = json::parse(headerText);
+	this->entities = this->header.at("Entities").get<std::vector<FrameEntity>>();
+	if(this->header.at("ByteOrder").get<string>() != trajectory::nativeByteOrder())
+	{
+		throw std::runtime_error(filePath.string() + " was written with another byte order");
+	}
+
+	std::size_t frameSize = 2;
+	std::vector<double> tolerances;
+	for(const FrameEntity & entity : this->entities)
+	{
+		this->entityOffsets.push_back(frameSize);
+		for(const TrajectoryField & field : entity.fields)
+		{
+			frameSize += field.components;
+			tolerances.insert(tolerances.end(), field.components, field.tolerance);
+		}
+	}
+	if(frameSize != this->header.at("FrameSize"))
+	{
+		throw std::runtime_error(filePath.string() + " has an inconsistent header");
+	}
+	this->codec = DeltaCodec(tolerances);
+	this->frame.resize(tolerances.size());
+
+	// An incomplete last record, as left by an interrupted run, is ignored
+	this->file.seekg(0, std::ios::end);
+	const std::streamoff fileSize = this->file.tellg();
+	std::streamoff offset = compressedframe::magicSize + sizeof(headerSize) + headerSize;
+	while(offset + static_cast<std::streamoff>(compressedframe::recordHeaderBytes) <= fileSize)
+	{
+		std::uint64_t encodingBytes;
+		std::uint8_t keyframe;
+		std::int64_t timeIndex;
+		double time;
+		this->file.seekg(offset);
+		this->file.read(reinterpret_cast<char *>(&encodingBytes), sizeof(encodingBytes));
+		this->file.read(reinterpret_cast<char *>(&keyframe), sizeof(keyframe));
+		this->file.read(reinterpret_cast<char *>(&timeIndex), sizeof(timeIndex));
+		this->file.read(reinterpret_cast<char *>(&time), sizeof(time));
+
+		offset += compressedframe::recordHeaderBytes;
+		if(offset + static_cast<std::streamoff>(encodingBytes) > fileSize) break;
+
+		this->records.push_back( Record{offset, encodingBytes, keyframe != 0, timeIndex, time} );
+		offset += encodingBytes;
+	}
+	this->file.clear();
+
+	if(not this->records.empty() and not this->records.front().keyframe)
+	{
+		throw std::runtime_error(filePath.string() + " does not start with a keyframe");
+	}
+	this->decodedFrame = this->records.size();
+}
+
+const json & CompressedFrameReader::getHeader() const
+{
+	return this->header;
+}
+
+const std::vector<FrameEntity> & CompressedFrameReader::getEntities() const
+{
+	return this->entities;
+}
+
+std::size_t CompressedFrameReader::getEntityIndex(const string & name) const
+{
+	for(std::size_t entity = 0; entity < this->entities.size(); ++entity)
+	{
+		if(this->entities[entity].name == name) return entity;
+	}
+
+	throw std::runtime_error("There is no entity " + name + " in this compressed frame file");
+}
+
+std::size_t CompressedFrameReader::getFrameSize() const
+{
+	return this->frame.size() + 2;
+}
+
+std::size_t CompressedFrameReader::getNumberOfFrames() const
+{
+	return this->records.size();
+}
+
+std::size_t CompressedFrameReader::getFieldOffset(const std::size_t entity, const string & field) const
+{
+	std::size_t offset = this->entityOffsets.at(entity);
+	for(const TrajectoryField & f : this->entities[entity].fields)
+	{
+		if(f.name == field) return offset;
+		offset += f.components;
+	}
+
+	throw std::runtime_error("Entity " + this->entities[entity].name + " has no field " + field);
+}
+
+std::vector<double> CompressedFrameReader::readFrame(const std::size_t frame)
+{
+	if(frame >= this->records.size())
+	{
+		throw std::out_of_range("Frame out of range");
+	}
+
+	// Decoding goes on from the last decoded frame when no keyframe lies between them
+	std::size_t first = frame;
+	while(not this->records[first].keyframe) --first;
+	if(this->decodedFrame < this->records.size() and this->decodedFrame >= first and this->decodedFrame <= frame)
+	{
+		first = this->decodedFrame + 1;
+	}
+	this->decodedFrame = this->records.size();
+
+	for(std::size_t current = first; current <= frame; ++current)
+	{
+		const Record & record = this->records[current];
+		if(record.keyframe) this->codec.reset();
+
+		this->encoding.resize(record.encodingBytes);
+		this->file.seekg(record.offset);
+		this->file.read(this->encoding.data(), this->encoding.size());
+
+		const char * end = this->encoding.data() + this->encoding.size();
+		if(this->codec.decode(this->encoding.data(), end, this->frame.data()) != end)
+		{
+			throw std::runtime_error("Corrupt compressed frame");
+		}
+		this->decodedFrame = current;
+	}
+
+	std::vector<double> values;
+	values.reserve(this->getFrameSize());
+	values.push_back(this->records[frame].timeIndex);
+	values.push_back(this->records[frame].time);
+	values.insert(values.end(), this->frame.begin(), this->frame.end());
+	return values;
+}
+
+std::size_t CompressedFrameReader::findTimeIndex(const long timeIndex) const
+{
+	return std::lower_bound(this->records.begin(), this->records.end(), timeIndex,
+		[](const Record & record, const long timeIndex){ return record.timeIndex < timeIndex; }
+	) - this->records.begin();
+}
+
+std::size_t CompressedFrameReader::findTime(const double time) const
+{
+	return std::lower_bound(this->records.begin(), this->records.end(), time,
+		[](const Record & record, const double time){ return record.time < time; }
+	) - this->records.begin();
+}
+
+} // psin
@@ -0,0 +1,98 @@
+#include <CompressedFrameWriter.hpp>
+
+// Standard
+#include <cstdint>
+#include <stdexcept>
+
+namespace psin {
+
+constexpr std::size_t CompressedFrameWriter::defaultKeyframeInterval;
+
+CompressedFrameWriter::~CompressedFrameWriter()
+{
+	this->close();
+}
+
+void CompressedFrameWriter::open(const path & filePath, const std::vector<FrameEntity> & entities, const std::size_t keyframeInterval, const json & description)
+{
+	this->close();
+
+	if(keyframeInterval == 0)
+	{
+		throw std::runtime_error("The keyframe interval must be positive.");
+	}
+
+	std::vector<double> tolerances;
+	for(const FrameEntity & entity : entities)
+	{
+		for(const TrajectoryField & field : entity.fields)
+		{
+			tolerances.insert(tolerances.end(), field.components, field.tolerance);
+		}
+	}
+	this->codec = DeltaCodec(tolerances);
+	this->keyframeInterval = keyframeInterval;
+	this->numberOfFrames = 0;
+
+	json header = description;
+	header["Entities"] = entities;
+	header["FrameSize"] = this->getFrameSize();
+	header["KeyframeInterval"] = keyframeInterval;
+	header["ByteOrder"] = trajectory::nativeByteOrder();
+	const string headerText = header.dump();
+	const std::uint64_t headerSize = headerText.size();
+
+	this->file.open(filePath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open compressed frame file " + filePath.string());
+	}
+
+	this->file.write(compressedframe::magic, compressedframe::magicSize);
+	this->file.write(reinterpret_cast<const char *>(&headerSize), sizeof(headerSize));
+	this->file.write(headerText.data(), headerText.size());
+}
+
+bool CompressedFrameWriter::isOpen() const
+{
+	return this->file.is_open();
+}
+
+std::size_t CompressedFrameWriter::getFrameSize() const
+{
+	return this->codec.getFrameSize() + 2;
+}
+
+void CompressedFrameWriter::append(const long timeIndex, const double time, const double * values)
+{
+	const std::uint8_t keyframe = (this->numberOfFrames % this->keyframeInterval == 0);
+	if(keyframe) this->codec.reset();
+
+	this->encoding.clear();
+	this->codec.encode(values, this->encoding);
+
+	const std::uint64_t encodingBytes = this->encoding.size();
+	const std::int64_t index = timeIndex;
+	this->file.write(reinterpret_cast<const char *>(&encodingBytes), sizeof(encodingBytes));
+	this->file.write(reinterpret_cast<const char *>(&keyframe), sizeof(keyframe));
+	this->file.write(reinterpret_cast<const char *>(&index), sizeof(index));
+	this->file.write(reinterpret_cast<const char *>(&time), sizeof(time));
+	this->file.write(this->encoding.data(), this->encoding.size());
+
+	++this->numberOfFrames;
+}
+
+void CompressedFrameWriter::flush()
+{
+	if(this->isOpen()) this->file.flush();
+}
+
+void CompressedFrameWriter::close()
+{
+	if(this->isOpen())
+	{
+		this->file.close();
+	}
+}
+
+} // psin
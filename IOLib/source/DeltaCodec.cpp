@@ -0,0 +1,157 @@
+#include <DeltaCodec.hpp>
+
+// Standard
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace psin {
+
+namespace {
+
+void writeVarint(std::uint64_t value, std::vector<char> & bytes)
+{
+	while(value >= 0x80)
+	{
+		bytes.push_back( static_cast<char>((value & 0x7f) | 0x80) );
+		value >>= 7;
+	}
+	bytes.push_back( static_cast<char>(value) );
+}
+
+std::uint64_t readVarint(const char * & begin, const char * end)
+{
+	std::uint64_t value = 0;
+	for(unsigned shift = 0; shift < 64; shift += 7)
+	{
+		if(begin == end)
+		{
+			throw std::runtime_error("Truncated delta-encoded frame");
+		}
+
+		const std::uint64_t byte = static_cast<unsigned char>(*begin++);
+		value |= (byte & 0x7f) << shift;
+		if(byte < 0x80) return value;
+	}
+
+	throw std::runtime_error("Corrupt delta-encoded frame");
+}
+
+// Small differences of either sign become small unsigned integers
+std::uint64_t zigzag(const std::uint64_t difference)
+{
+	return (difference << 1) ^ (difference >> 63 ? ~std::uint64_t(0) : 0);
+}
+
+std::uint64_t unzigzag(const std::uint64_t value)
+{
+	return (value >> 1) ^ (value & 1 ? ~std::uint64_t(0) : 0);
+}
+
+} // anonymous namespace
+
+DeltaCodec::DeltaCodec(const std::vector<double> & tolerances)
+	: steps(tolerances.size()),
+	previous(tolerances.size(), 0)
+{
+	for(std::size_t value = 0; value < tolerances.size(); ++value)
+	{
+		if(not (tolerances[value] >= 0.0))
+		{
+			throw std::runtime_error("Tolerances must not be negative.");
+		}
+		this->steps[value] = 2.0 * tolerances[value];
+	}
+}
+
+std::size_t DeltaCodec::getFrameSize() const
+{
+	return this->steps.size();
+}
+
+void DeltaCodec::reset()
+{
+	std::fill(this->previous.begin(), this->previous.end(), 0);
+}
+
+void DeltaCodec::encode(const double * frame, std::vector<char> & bytes)
+{
+	// Factors beyond 2^62 could overflow a word
+	constexpr double largestFactor = 4.6e18;
+
+	std::uint64_t unchanged = 0;
+	for(std::size_t value = 0; value < this->steps.size(); ++value)
+	{
+		std::uint64_t word;
+		if(this->steps[value] > 0.0)
+		{
+			const double factor = std::round(frame[value] / this->steps[value]);
+			if(not (std::abs(factor) < largestFactor))
+			{
+				throw std::runtime_error("Value " + std::to_string(frame[value]) + " cannot be quantized with tolerance " + std::to_string(this->steps[value] / 2));
+			}
+			word = static_cast<std::uint64_t>( static_cast<std::int64_t>(factor) );
+		}
+		else std::memcpy(&word, &frame[value], sizeof(word));
+
+		const std::uint64_t difference = (this->steps[value] > 0.0) ? zigzag(word - this->previous[value]) : (word ^ this->previous[value]);
+		this->previous[value] = word;
+
+		if(difference == 0)
+		{
+			++unchanged;
+			continue;
+		}
+
+		if(unchanged > 0)
+		{
+			writeVarint(0, bytes);
+			writeVarint(unchanged - 1, bytes);
+			unchanged = 0;
+		}
+		writeVarint(difference, bytes);
+	}
+
+	if(unchanged > 0)
+	{
+		writeVarint(0, bytes);
+		writeVarint(unchanged - 1, bytes);
+	}
+}
+
+const char * DeltaCodec::decode(const char * begin, const char * end, double * frame)
+{
+	std::uint64_t unchanged = 0;
+	for(std::size_t value = 0; value < this->steps.size(); ++value)
+	{
+		std::uint64_t difference = 0;
+		if(unchanged > 0) --unchanged;
+		else
+		{
+			difference = readVarint(begin, end);
+			if(difference == 0) unchanged = readVarint(begin, end);
+		}
+
+		std::uint64_t & word = this->previous[value];
+		if(this->steps[value] > 0.0)
+		{
+			word += unzigzag(difference);
+			frame[value] = static_cast<double>( static_cast<std::int64_t>(word) ) * this->steps[value];
+		}
+		else
+		{
+			word ^= difference;
+			std::memcpy(&frame[value], &word, sizeof(word));
+		}
+	}
+
+	if(unchanged > 0)
+	{
+		throw std::runtime_error("Corrupt delta-encoded frame");
+	}
+	return begin;
+}
+
+} // psin
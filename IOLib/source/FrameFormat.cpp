@@ -0,0 +1,21 @@
+#include <FrameFormat.hpp>
+
+namespace psin {
+
+void to_json(json & j, const FrameEntity & entity)
+{
+	j = entity.description;
+	j["Name"] = entity.name;
+	j["Fields"] = entity.fields;
+}
+
+void from_json(const json & j, FrameEntity & entity)
+{
+	entity.name = j.at("Name").get<string>();
+	entity.fields = j.at("Fields").get<std::vector<TrajectoryField>>();
+	entity.description = j;
+	entity.description.erase("Name");
+	entity.description.erase("Fields");
+}
+
+} // psin
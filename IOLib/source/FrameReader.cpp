@@ -0,0 +1,195 @@
+#include <FrameReader.hpp>
+
+// Standard
+#include <cstring>
+#include <stdexcept>
+
+namespace psin {
+
+FrameReader::FrameReader(const path & filePath)
+	: file(filePath.string(), std::ios::in | std::ios::binary)
+{
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open frame file " + filePath.string());
+	}
+
+	char magic[frame::magicSize];
+	std::uint64_t headerSize = 0;
+	this->file.read(magic, frame::magicSize);
+	this->file.read(reinterpret_cast<char *>(&headerSize), sizeof(headerSize));
+	if(not this->file or std::memcmp(magic, frame::magic, frame::magicSize) != 0)
+	{
+		throw std::runtime_error(filePath.string() + " is not a frame file");
+	}
+
+	string headerText(headerSize, '\0');
+	this->file.read(&headerText[0], headerSize);
+	this->header = json::parse(headerText);
+	this->entities = this->header.at("Entities").get<std::vector<FrameEntity>>();
+
+	std::vector<TrajectoryField> allFields{ {trajectory::timeIndexField, 1}, {trajectory::timeField, 1} };
+	for(const FrameEntity & entity : this->entities)
+	{
+		std::size_t offset = 0;
+		for(const TrajectoryField & field : allFields) offset += field.components;
+		this->entityOffsets.push_back(offset);
+
+		allFields.insert(allFields.end(), entity.fields.begin(), entity.fields.end());
+	}
+	this->layout = RecordLayout(allFields);
+	if(this->layout.getSize() != this->header.at("FrameSize"))
+	{
+		throw std::runtime_error(filePath.string() + " has an inconsistent header");
+	}
+
+	// An incomplete last frame, as left by an interrupted run, is ignored
+	this->firstFrameOffset = frame::magicSize + sizeof(headerSize) + headerSize;
+	this->file.seekg(0, std::ios::end);
+	const std::streamoff fileSize = this->file.tellg();
+	if(this->layout.getBytes() > 0 and fileSize > this->firstFrameOffset)
+	{
+		this->numberOfFrames = (fileSize - this->firstFrameOffset) / this->layout.getBytes();
+	}
+	this->file.clear();
+}
+
+const json & FrameReader::getHeader() const
+{
+	return this->header;
+}
+
+const std::vector<FrameEntity> & FrameReader::getEntities() const
+{
+	return this->entities;
+}
+
+std::size_t FrameReader::getEntityIndex(const string & name) const
+{
+	for(std::size_t entity = 0; entity < this->entities.size(); ++entity)
+	{
+		if(this->entities[entity].name == name) return entity;
+	}
+
+	throw std::runtime_error("There is no entity " + name + " in this frame file");
+}
+
+std::size_t FrameReader::getFrameSize() const
+{
+	return this->layout.getSize();
+}
+
+std::size_t FrameReader::getFrameBytes() const
+{
+	return this->layout.getBytes();
+}
+
+std::size_t FrameReader::getNumberOfFrames() const
+{
+	return this->numberOfFrames;
+}
+
+std::size_t FrameReader::getFieldOffset(const std::size_t entity, const string & field) const
+{
+	std::size_t offset = this->entityOffsets.at(entity);
+	for(const TrajectoryField & f : this->entities[entity].fields)
+	{
+		if(f.name == field) return offset;
+		offset += f.components;
+	}
+
+	throw std::runtime_error("Entity " + this->entities[entity].name + " has no field " + field);
+}
+
+std::streamoff FrameReader::offsetOf(const std::size_t frame) const
+{
+	if(frame >= this->numberOfFrames)
+	{
+		throw std::out_of_range("Frame out of range");
+	}
+
+	return this->firstFrameOffset + static_cast<std::streamoff>(frame * this->layout.getBytes());
+}
+
+double FrameReader::readValue(const std::size_t frame, const std::size_t offset)
+{
+	char bytes[sizeof(double)];
+	this->file.seekg( this->offsetOf(frame) + this->layout.getByteOffset(offset) );
+	this->file.read(bytes, this->layout.getValueBytes(offset));
+	return this->layout.decodeValue(bytes, offset);
+}
+
+std::vector<double> FrameReader::readFrame(const std::size_t frame)
+{
+	std::vector<char> bytes(this->layout.getBytes());
+	this->file.seekg( this->offsetOf(frame) );
+	this->file.read(bytes.data(), bytes.size());
+
+	std::vector<double> values(this->layout.getSize());
+	for(std::size_t value = 0; value < values.size(); ++value)
+	{
+		values[value] = this->layout.decode(bytes.data(), value);
+	}
+	return values;
+}
+
+std::vector<double> FrameReader::readField(const std::size_t entity, const string & field, const std::size_t firstFrame, const std::size_t lastFrame)
+{
+	const std::size_t offset = this->getFieldOffset(entity, field);
+	std::size_t components = 0;
+	for(const TrajectoryField & f : this->entities[entity].fields)
+	{
+		if(f.name == field) components = f.components;
+	}
+
+	// A field's values are contiguous in a frame, so each frame takes a single read
+	const std::size_t first = this->layout.getByteOffset(offset);
+	const std::size_t last = this->layout.getByteOffset(offset + components - 1) + this->layout.getValueBytes(offset + components - 1);
+	std::vector<char> bytes(last - first);
+
+	std::vector<double> values;
+	values.reserve( (lastFrame - firstFrame) * components );
+	for(std::size_t frame = firstFrame; frame < lastFrame; ++frame)
+	{
+		this->file.seekg( this->offsetOf(frame) + first );
+		this->file.read(bytes.data(), bytes.size());
+
+		for(std::size_t component = 0; component < components; ++component)
+		{
+			const std::size_t value = offset + component;
+			values.push_back( this->layout.decodeValue(bytes.data() + this->layout.getByteOffset(value) - first, value) );
+		}
+	}
+
+	return values;
+}
+
+template<typename Compare>
+std::size_t FrameReader::lowerBound(const std::size_t offset, Compare && isBefore)
+{
+	std::size_t first = 0;
+	std::size_t count = this->numberOfFrames;
+	while(count > 0)
+	{
+		const std::size_t step = count / 2;
+		if( isBefore(this->readValue(first + step, offset)) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else count = step;
+	}
+	return first;
+}
+
+std::size_t FrameReader::findTimeIndex(const long timeIndex)
+{
+	return this->lowerBound(0, [timeIndex](const double value){ return value < timeIndex; });
+}
+
+std::size_t FrameReader::findTime(const double time)
+{
+	return this->lowerBound(1, [time](const double value){ return value < time; });
+}
+
+} // psin
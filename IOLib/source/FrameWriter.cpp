@@ -0,0 +1,89 @@
+#include <FrameWriter.hpp>
+
+// Standard
+#include <stdexcept>
+
+namespace psin {
+
+FrameWriter::FrameWriter(const path & filePath, const std::vector<FrameEntity> & entities, const json & description)
+{
+	this->open(filePath, entities, description);
+}
+
+FrameWriter::~FrameWriter()
+{
+	this->close();
+}
+
+void FrameWriter::open(const path & filePath, const std::vector<FrameEntity> & entities, const json & description)
+{
+	this->close();
+
+	std::vector<TrajectoryField> allFields{ {trajectory::timeIndexField, 1}, {trajectory::timeField, 1} };
+	for(const FrameEntity & entity : entities)
+	{
+		allFields.insert(allFields.end(), entity.fields.begin(), entity.fields.end());
+	}
+	this->layout = RecordLayout(allFields);
+	this->frame.assign(this->layout.getBytes(), 0);
+
+	json header = description;
+	header["Entities"] = entities;
+	header["FrameSize"] = this->layout.getSize();
+	header["FrameBytes"] = this->layout.getBytes();
+	header["ByteOrder"] = trajectory::nativeByteOrder();
+	const string headerText = header.dump();
+	const std::uint64_t headerSize = headerText.size();
+
+	this->file.open(filePath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open frame file " + filePath.string());
+	}
+
+	this->file.write(frame::magic, frame::magicSize);
+	this->file.write(reinterpret_cast<const char *>(&headerSize), sizeof(headerSize));
+	this->file.write(headerText.data(), headerText.size());
+}
+
+bool FrameWriter::isOpen() const
+{
+	return this->file.is_open();
+}
+
+std::size_t FrameWriter::getFrameSize() const
+{
+	return this->layout.getSize();
+}
+
+std::size_t FrameWriter::getFrameBytes() const
+{
+	return this->layout.getBytes();
+}
+
+void FrameWriter::append(const long timeIndex, const double time, const double * values)
+{
+	this->layout.encode(0, static_cast<double>(timeIndex), this->frame.data());
+	this->layout.encode(1, time, this->frame.data());
+	for(std::size_t i = 2; i < this->layout.getSize(); ++i)
+	{
+		this->layout.encode(i, values[i - 2], this->frame.data());
+	}
+
+	this->file.write(this->frame.data(), this->frame.size());
+}
+
+void FrameWriter::flush()
+{
+	if(this->isOpen()) this->file.flush();
+}
+
+void FrameWriter::close()
+{
+	if(this->isOpen())
+	{
+		this->file.close();
+	}
+}
+
+} // psin
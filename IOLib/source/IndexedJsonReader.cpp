@@ -0,0 +1,80 @@
+#include <IndexedJsonReader.hpp>
+
+// Standard
+#include <stdexcept>
+
+namespace psin {
+
+IndexedJsonReader::IndexedJsonReader(const path & streamPath)
+	: file(streamPath.string(), std::ios::in | std::ios::binary),
+	index(timeindex::indexPathOf(streamPath))
+{
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open JSON output file " + streamPath.string());
+	}
+}
+
+TimeIndexReader & IndexedJsonReader::getIndex()
+{
+	return this->index;
+}
+
+std::size_t IndexedJsonReader::getNumberOfEntries() const
+{
+	return this->index.getNumberOfEntries();
+}
+
+// Entries are JSON objects. Each one spans from its offset to the next entry's, or to the end of
+// the stream, followed by a separator or by the closing bracket of the array.
+json IndexedJsonReader::readEntry(const std::size_t entry)
+{
+	const std::streamoff begin = this->index.getEntry(entry).offset;
+
+	std::streamoff end;
+	if(entry + 1 < this->index.getNumberOfEntries())
+	{
+		end = this->index.getEntry(entry + 1).offset;
+	}
+	else
+	{
+		this->file.seekg(0, std::ios::end);
+		end = this->file.tellg();
+	}
+
+	string text(end - begin, '\0');
+	this->file.clear();
+	this->file.seekg(begin);
+	this->file.read(&text[0], text.size());
+
+	const std::size_t last = text.find_last_of('}');
+	if(not this->file or last == string::npos)
+	{
+		throw std::runtime_error("Entry " + std::to_string(entry) + " of the JSON output is incomplete");
+	}
+	text.resize(last + 1);
+
+	return json::parse(text);
+}
+
+json IndexedJsonReader::readAtTimeIndex(const long timeIndex)
+{
+	const std::size_t entry = this->index.findTimeIndex(timeIndex);
+	if(entry == this->index.getNumberOfEntries() or static_cast<long>(this->index.getEntry(entry).timeIndex) != timeIndex)
+	{
+		throw std::runtime_error("Nothing was stored at time index " + std::to_string(timeIndex));
+	}
+	return this->readEntry(entry);
+}
+
+json IndexedJsonReader::readAtTime(const double time)
+{
+	const std::size_t entry = this->index.findTime(time);
+	if(entry == this->index.getNumberOfEntries())
+	{
+		throw std::runtime_error("Nothing was stored at or after time " + std::to_string(time));
+	}
+	return this->readEntry(entry);
+}
+
+} // psin
@@ -0,0 +1,55 @@
+#include <JsonLinesReader.hpp>
+
+// Standard
+#include <stdexcept>
+
+namespace psin {
+
+JsonLinesReader::JsonLinesReader(const path & filePath)
+	: file(filePath.string(), std::ios::in | std::ios::binary)
+{
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open JSON Lines file " + filePath.string());
+	}
+}
+
+std::vector<json> JsonLinesReader::readAvailable()
+{
+	// Clearing the end of file state lets the stream see what was appended since the last call
+	this->file.clear();
+	this->file.seekg(0, std::ios::end);
+	const std::streamoff fileSize = this->file.tellg();
+
+	std::vector<json> entries;
+	if(fileSize <= this->offset) return entries;
+
+	string text(fileSize - this->offset, '\0');
+	this->file.seekg(this->offset);
+	this->file.read(&text[0], text.size());
+
+	const std::size_t end = text.rfind('\n');
+	if(end == string::npos) return entries;
+
+	std::size_t begin = 0;
+	while(begin < end)
+	{
+		const std::size_t lineEnd = text.find('\n', begin);
+		if(lineEnd > begin)
+		{
+			entries.push_back( json::parse(text.begin() + begin, text.begin() + lineEnd) );
+		}
+		begin = lineEnd + 1;
+	}
+
+	this->offset += end + 1;
+	this->numberOfEntriesRead += entries.size();
+	return entries;
+}
+
+std::size_t JsonLinesReader::getNumberOfEntriesRead() const
+{
+	return this->numberOfEntriesRead;
+}
+
+} // psin
@@ -0,0 +1,62 @@
+#include <OutputBuffer.hpp>
+
+// Standard
+#include <stdexcept>
+
+namespace psin {
+
+constexpr std::size_t OutputBuffer::defaultByteBudget;
+
+OutputBuffer::OutputBuffer(const std::size_t byteBudget)
+{
+	this->setByteBudget(byteBudget);
+}
+
+void OutputBuffer::setByteBudget(const std::size_t byteBudget)
+{
+	if(byteBudget == 0)
+	{
+		throw std::runtime_error("The output byte budget must be positive.");
+	}
+
+	this->byteBudget = byteBudget;
+}
+
+std::size_t OutputBuffer::getByteBudget() const
+{
+	return this->byteBudget;
+}
+
+void OutputBuffer::append(Frame && frame)
+{
+	this->size += frame.size() * sizeof(double);
+	this->frames.push_back(std::move(frame));
+}
+
+const std::vector<OutputBuffer::Frame> & OutputBuffer::getFrames() const
+{
+	return this->frames;
+}
+
+bool OutputBuffer::empty() const
+{
+	return this->frames.empty();
+}
+
+std::size_t OutputBuffer::getSize() const
+{
+	return this->size;
+}
+
+bool OutputBuffer::isFull() const
+{
+	return this->size >= this->byteBudget;
+}
+
+void OutputBuffer::clear()
+{
+	this->frames.clear();
+	this->size = 0;
+}
+
+} // psin
@@ -0,0 +1,10 @@
+#include <TimeIndexFormat.hpp>
+
+namespace psin {
+
+path timeindex::indexPathOf(const path & streamPath)
+{
+	return path(streamPath.string() + ".index");
+}
+
+} // psin
@@ -0,0 +1,102 @@
+#include <TimeIndexReader.hpp>
+
+// IOLib
+#include <TrajectoryFormat.hpp>
+
+// Standard
+#include <cstring>
+#include <stdexcept>
+
+namespace psin {
+
+TimeIndexReader::TimeIndexReader(const path & filePath)
+	: file(filePath.string(), std::ios::in | std::ios::binary)
+{
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open time index file " + filePath.string());
+	}
+
+	char magic[timeindex::magicSize];
+	std::uint64_t headerSize = 0;
+	this->file.read(magic, timeindex::magicSize);
+	this->file.read(reinterpret_cast<char *>(&headerSize), sizeof(headerSize));
+	if(not this->file or std::memcmp(magic, timeindex::magic, timeindex::magicSize) != 0)
+	{
+		throw std::runtime_error(filePath.string() + " is not a time index file");
+	}
+
+	string headerText(headerSize, '\0');
+	this->file.read(&headerText[0], headerSize);
+	this->header = json::parse(headerText);
+	this->entryBytes = this->header.at("EntryBytes");
+	if(this->header.at("ByteOrder") != trajectory::nativeByteOrder())
+	{
+		throw std::runtime_error(filePath.string() + " was written with another byte order");
+	}
+
+	// An incomplete last entry, as left by an interrupted run, is ignored
+	this->firstEntryOffset = timeindex::magicSize + sizeof(headerSize) + headerSize;
+	this->file.seekg(0, std::ios::end);
+	const std::streamoff fileSize = this->file.tellg();
+	if(this->entryBytes > 0 and fileSize > this->firstEntryOffset)
+	{
+		this->numberOfEntries = (fileSize - this->firstEntryOffset) / this->entryBytes;
+	}
+	this->file.clear();
+}
+
+const json & TimeIndexReader::getHeader() const
+{
+	return this->header;
+}
+
+std::size_t TimeIndexReader::getNumberOfEntries() const
+{
+	return this->numberOfEntries;
+}
+
+TimeIndexEntry TimeIndexReader::getEntry(const std::size_t entry)
+{
+	if(entry >= this->numberOfEntries)
+	{
+		throw std::out_of_range("Time index entry out of range");
+	}
+
+	TimeIndexEntry indexEntry;
+	this->file.seekg( this->firstEntryOffset + entry * this->entryBytes );
+	this->file.read(reinterpret_cast<char *>(&indexEntry.timeIndex), sizeof(indexEntry.timeIndex));
+	this->file.read(reinterpret_cast<char *>(&indexEntry.timeInstant), sizeof(indexEntry.timeInstant));
+	this->file.read(reinterpret_cast<char *>(&indexEntry.offset), sizeof(indexEntry.offset));
+	return indexEntry;
+}
+
+template<typename Compare>
+std::size_t TimeIndexReader::lowerBound(Compare && isBefore)
+{
+	std::size_t first = 0;
+	std::size_t count = this->numberOfEntries;
+	while(count > 0)
+	{
+		const std::size_t step = count / 2;
+		if( isBefore(this->getEntry(first + step)) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else count = step;
+	}
+	return first;
+}
+
+std::size_t TimeIndexReader::findTimeIndex(const long timeIndex)
+{
+	return this->lowerBound([timeIndex](const TimeIndexEntry & entry){ return static_cast<long>(entry.timeIndex) < timeIndex; });
+}
+
+std::size_t TimeIndexReader::findTime(const double time)
+{
+	return this->lowerBound([time](const TimeIndexEntry & entry){ return entry.timeInstant < time; });
+}
+
+} // psin
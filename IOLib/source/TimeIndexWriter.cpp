@@ -0,0 +1,69 @@
+#include <TimeIndexWriter.hpp>
+
+// IOLib
+#include <TrajectoryFormat.hpp>
+
+// Standard
+#include <stdexcept>
+
+namespace psin {
+
+TimeIndexWriter::~TimeIndexWriter()
+{
+	this->close();
+}
+
+void TimeIndexWriter::open(const path & filePath, const json & description)
+{
+	this->close();
+
+	json header = description;
+	header["EntryBytes"] = sizeof(std::uint64_t) + sizeof(double) + sizeof(std::uint64_t);
+	header["ByteOrder"] = trajectory::nativeByteOrder();
+	const string headerText = header.dump();
+	const std::uint64_t headerSize = headerText.size();
+
+	this->file.open(filePath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open time index file " + filePath.string());
+	}
+
+	this->file.write(timeindex::magic, timeindex::magicSize);
+	this->file.write(reinterpret_cast<const char *>(&headerSize), sizeof(headerSize));
+	this->file.write(headerText.data(), headerText.size());
+}
+
+bool TimeIndexWriter::isOpen() const
+{
+	return this->file.is_open();
+}
+
+// Members are written one by one, so that the entry has no padding
+void TimeIndexWriter::append(const long timeIndex, const double time, const std::uint64_t offset)
+{
+	const std::uint64_t index = timeIndex;
+	this->file.write(reinterpret_cast<const char *>(&index), sizeof(index));
+	this->file.write(reinterpret_cast<const char *>(&time), sizeof(time));
+	this->file.write(reinterpret_cast<const char *>(&offset), sizeof(offset));
+}
+
+void TimeIndexWriter::append(const long timeIndex, const double time, std::ostream & stream)
+{
+	this->append(timeIndex, time, static_cast<std::uint64_t>(stream.tellp()));
+}
+
+void TimeIndexWriter::flush()
+{
+	if(this->isOpen()) this->file.flush();
+}
+
+void TimeIndexWriter::close()
+{
+	if(this->isOpen())
+	{
+		this->file.close();
+	}
+}
+
+} // psin
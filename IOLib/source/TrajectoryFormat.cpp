@@ -0,0 +1,108 @@
+#include <TrajectoryFormat.hpp>
+
+// Standard
+#include <cstring>
+#include <stdexcept>
+
+namespace psin {
+
+std::size_t trajectory::valueSize(const string & type)
+{
+	if(type == trajectory::float64Type) return sizeof(double);
+	if(type == trajectory::float32Type) return sizeof(float);
+
+	throw std::runtime_error("Unknown trajectory value type " + type);
+}
+
+string trajectory::nativeByteOrder()
+{
+	const std::uint16_t one = 1;
+	return *reinterpret_cast<const unsigned char *>(&one) == 1 ? "little" : "big";
+}
+
+void to_json(json & j, const TrajectoryField & field)
+{
+	j = json{
+		{"Name", field.name},
+		{"Components", field.components},
+		{"Type", field.type}
+	};
+	if(field.tolerance > 0.0) j["Tolerance"] = field.tolerance;
+}
+
+void from_json(const json & j, TrajectoryField & field)
+{
+	field.name = j.at("Name").get<string>();
+	field.components = j.at("Components").get<std::size_t>();
+	field.type = j.count("Type") > 0 ? j.at("Type").get<string>() : trajectory::float64Type;
+	trajectory::valueSize(field.type);
+	field.tolerance = j.count("Tolerance") > 0 ? j.at("Tolerance").get<double>() : 0.0;
+}
+
+RecordLayout::RecordLayout(const std::vector<TrajectoryField> & fields)
+{
+	for(const TrajectoryField & field : fields)
+	{
+		const std::size_t valueBytes = trajectory::valueSize(field.type);
+		for(std::size_t component = 0; component < field.components; ++component)
+		{
+			this->byteOffsets.push_back(this->bytes);
+			this->singlePrecision.push_back(field.type == trajectory::float32Type);
+			this->bytes += valueBytes;
+		}
+	}
+}
+
+std::size_t RecordLayout::getSize() const
+{
+	return this->byteOffsets.size();
+}
+
+std::size_t RecordLayout::getBytes() const
+{
+	return this->bytes;
+}
+
+std::size_t RecordLayout::getByteOffset(const std::size_t value) const
+{
+	return this->byteOffsets[value];
+}
+
+std::size_t RecordLayout::getValueBytes(const std::size_t value) const
+{
+	return this->singlePrecision[value] ? sizeof(float) : sizeof(double);
+}
+
+void RecordLayout::encode(const std::size_t value, const double x, char * record) const
+{
+	if(this->singlePrecision[value])
+	{
+		const float single = static_cast<float>(x);
+		std::memcpy(record + this->byteOffsets[value], &single, sizeof(single));
+	}
+	else
+	{
+		std::memcpy(record + this->byteOffsets[value], &x, sizeof(x));
+	}
+}
+
+double RecordLayout::decode(const char * record, const std::size_t value) const
+{
+	return this->decodeValue(record + this->byteOffsets[value], value);
+}
+
+double RecordLayout::decodeValue(const char * bytes, const std::size_t value) const
+{
+	if(this->singlePrecision[value])
+	{
+		float single;
+		std::memcpy(&single, bytes, sizeof(single));
+		return single;
+	}
+
+	double x;
+	std::memcpy(&x, bytes, sizeof(x));
+	return x;
+}
+
+} // psin
@@ -0,0 +1,199 @@
+#include <TrajectoryReader.hpp>
+
+// Standard
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace psin {
+
+TrajectoryReader::TrajectoryReader(const path & filePath)
+	: file(filePath.string(), std::ios::in | std::ios::binary)
+{
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open trajectory file " + filePath.string());
+	}
+
+	char magic[trajectory::magicSize];
+	std::uint64_t headerSize = 0;
+	this->file.read(magic, trajectory::magicSize);
+	this->file.read(reinterpret_cast<char *>(&headerSize), sizeof(headerSize));
+	if(not this->file or std::memcmp(magic, trajectory::magic, trajectory::magicSize) != 0)
+	{
+		throw std::runtime_error(filePath.string() + " is not a trajectory file");
+	}
+
+	string headerText(headerSize, '\0');
+	this->file.read(&headerText[0], headerSize);
+	this->header = json::parse(headerText);
+	this->fields = this->header.at("Fields").get<std::vector<TrajectoryField>>();
+	this->layout = RecordLayout(this->fields);
+	if(this->layout.getSize() != this->header.at("RecordSize"))
+	{
+		throw std::runtime_error(filePath.string() + " has an inconsistent header");
+	}
+
+	// Hops from chunk to chunk, reading only their sizes. An incomplete last chunk, as left by an
+	// interrupted run, is ignored.
+	this->file.seekg(0, std::ios::end);
+	const std::streamoff fileSize = this->file.tellg();
+	std::streamoff offset = trajectory::magicSize + sizeof(headerSize) + headerSize;
+
+	while(offset + static_cast<std::streamoff>(sizeof(std::uint64_t)) <= fileSize)
+	{
+		std::uint64_t chunkRecords = 0;
+		this->file.seekg(offset);
+		this->file.read(reinterpret_cast<char *>(&chunkRecords), sizeof(chunkRecords));
+
+		const std::streamoff first = offset + sizeof(chunkRecords);
+		const std::streamoff end = first + chunkRecords * this->layout.getBytes();
+		if(end > fileSize) break;
+
+		this->chunks.push_back( Chunk{first, this->numberOfRecords, chunkRecords} );
+		this->numberOfRecords += chunkRecords;
+		offset = end;
+	}
+	this->file.clear();
+}
+
+const json & TrajectoryReader::getHeader() const
+{
+	return this->header;
+}
+
+const std::vector<TrajectoryField> & TrajectoryReader::getFields() const
+{
+	return this->fields;
+}
+
+std::size_t TrajectoryReader::getRecordSize() const
+{
+	return this->layout.getSize();
+}
+
+std::size_t TrajectoryReader::getRecordBytes() const
+{
+	return this->layout.getBytes();
+}
+
+std::size_t TrajectoryReader::getNumberOfRecords() const
+{
+	return this->numberOfRecords;
+}
+
+std::size_t TrajectoryReader::getFieldOffset(const string & field) const
+{
+	std::size_t offset = 0;
+	for(const TrajectoryField & f : this->fields)
+	{
+		if(f.name == field) return offset;
+		offset += f.components;
+	}
+
+	throw std::runtime_error("There is no field " + field + " in this trajectory");
+}
+
+std::streamoff TrajectoryReader::offsetOf(const std::size_t record) const
+{
+	if(record >= this->numberOfRecords)
+	{
+		throw std::out_of_range("Trajectory record out of range");
+	}
+
+	// The chunk holding record is the last one starting at or before it
+	const auto chunk = std::prev( std::upper_bound(this->chunks.begin(), this->chunks.end(), record,
+		[](const std::size_t r, const Chunk & c){ return r < c.firstRecord; }) );
+
+	return chunk->offset + (record - chunk->firstRecord) * this->layout.getBytes();
+}
+
+double TrajectoryReader::readValue(const std::size_t record, const std::size_t offset)
+{
+	char bytes[sizeof(double)];
+	this->file.seekg( this->offsetOf(record) + this->layout.getByteOffset(offset) );
+	this->file.read(bytes, this->layout.getValueBytes(offset));
+	return this->layout.decodeValue(bytes, offset);
+}
+
+std::vector<double> TrajectoryReader::readRecord(const std::size_t record)
+{
+	std::vector<char> bytes(this->layout.getBytes());
+	this->file.seekg( this->offsetOf(record) );
+	this->file.read(bytes.data(), bytes.size());
+
+	std::vector<double> values(this->layout.getSize());
+	for(std::size_t value = 0; value < values.size(); ++value)
+	{
+		values[value] = this->layout.decode(bytes.data(), value);
+	}
+	return values;
+}
+
+std::vector<double> TrajectoryReader::readField(const string & field, const std::size_t firstRecord, const std::size_t lastRecord)
+{
+	const std::size_t offset = this->getFieldOffset(field);
+	std::size_t components = 0;
+	for(const TrajectoryField & f : this->fields)
+	{
+		if(f.name == field) components = f.components;
+	}
+
+	std::vector<double> values;
+	values.reserve( (lastRecord - firstRecord) * components );
+
+	// Records are contiguous inside a chunk, so each chunk's part of the range is read at once
+	std::vector<char> buffer;
+	for(const Chunk & chunk : this->chunks)
+	{
+		const std::size_t begin = std::max(firstRecord, chunk.firstRecord);
+		const std::size_t end = std::min(lastRecord, chunk.firstRecord + chunk.numberOfRecords);
+		if(begin >= end) continue;
+
+		buffer.resize( (end - begin) * this->layout.getBytes() );
+		this->file.seekg( this->offsetOf(begin) );
+		this->file.read(buffer.data(), buffer.size());
+
+		for(std::size_t record = 0; record < end - begin; ++record)
+		{
+			for(std::size_t component = 0; component < components; ++component)
+			{
+				values.push_back( this->layout.decode(buffer.data() + record * this->layout.getBytes(), offset + component) );
+			}
+		}
+	}
+
+	return values;
+}
+
+template<typename Compare>
+std::size_t TrajectoryReader::lowerBound(const std::size_t offset, Compare && isBefore)
+{
+	std::size_t first = 0;
+	std::size_t count = this->numberOfRecords;
+	while(count > 0)
+	{
+		const std::size_t step = count / 2;
+		if( isBefore(this->readValue(first + step, offset)) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else count = step;
+	}
+	return first;
+}
+
+std::size_t TrajectoryReader::findTimeIndex(const long timeIndex)
+{
+	return this->lowerBound(this->getFieldOffset(trajectory::timeIndexField),
+		[timeIndex](const double value){ return value < timeIndex; });
+}
+
+std::size_t TrajectoryReader::findTime(const double time)
+{
+	return this->lowerBound(this->getFieldOffset(trajectory::timeField),
+		[time](const double value){ return value < time; });
+}
+
+} // psin
@@ -0,0 +1,101 @@
+#include <TrajectoryWriter.hpp>
+
+// Standard
+#include <stdexcept>
+
+namespace psin {
+
+TrajectoryWriter::TrajectoryWriter(const path & filePath, const std::vector<TrajectoryField> & fields, const json & description)
+{
+	this->open(filePath, fields, description);
+}
+
+TrajectoryWriter::~TrajectoryWriter()
+{
+	this->close();
+}
+
+void TrajectoryWriter::open(const path & filePath, const std::vector<TrajectoryField> & fields, const json & description)
+{
+	this->close();
+
+	std::vector<TrajectoryField> allFields{ {trajectory::timeIndexField, 1}, {trajectory::timeField, 1} };
+	allFields.insert(allFields.end(), fields.begin(), fields.end());
+
+	this->layout = RecordLayout(allFields);
+
+	json header = description;
+	header["Fields"] = allFields;
+	header["RecordSize"] = this->layout.getSize();
+	header["RecordBytes"] = this->layout.getBytes();
+	header["ByteOrder"] = trajectory::nativeByteOrder();
+	const string headerText = header.dump();
+	const std::uint64_t headerSize = headerText.size();
+
+	this->file.open(filePath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(not this->file)
+	{
+		throw std::runtime_error("Could not open trajectory file " + filePath.string());
+	}
+
+	this->file.write(trajectory::magic, trajectory::magicSize);
+	this->file.write(reinterpret_cast<const char *>(&headerSize), sizeof(headerSize));
+	this->file.write(headerText.data(), headerText.size());
+}
+
+bool TrajectoryWriter::isOpen() const
+{
+	return this->file.is_open();
+}
+
+std::size_t TrajectoryWriter::getRecordSize() const
+{
+	return this->layout.getSize();
+}
+
+std::size_t TrajectoryWriter::getRecordBytes() const
+{
+	return this->layout.getBytes();
+}
+
+std::size_t TrajectoryWriter::getNumberOfBufferedRecords() const
+{
+	return this->layout.getBytes() == 0 ? 0 : this->chunk.size() / this->layout.getBytes();
+}
+
+void TrajectoryWriter::append(const long timeIndex, const double time, const double * values)
+{
+	const std::size_t position = this->chunk.size();
+	this->chunk.resize(position + this->layout.getBytes());
+	char * record = &this->chunk[position];
+
+	this->layout.encode(0, static_cast<double>(timeIndex), record);
+	this->layout.encode(1, time, record);
+	for(std::size_t i = 2; i < this->layout.getSize(); ++i)
+	{
+		this->layout.encode(i, values[i - 2], record);
+	}
+}
+
+void TrajectoryWriter::flush()
+{
+	if(this->chunk.empty() or not this->isOpen()) return;
+
+	const std::uint64_t numberOfRecords = this->getNumberOfBufferedRecords();
+	this->file.write(reinterpret_cast<const char *>(&numberOfRecords), sizeof(numberOfRecords));
+	this->file.write(this->chunk.data(), this->chunk.size());
+	this->file.flush();
+
+	this->chunk.clear();
+}
+
+void TrajectoryWriter::close()
+{
+	if(this->isOpen())
+	{
+		this->flush();
+		this->file.close();
+	}
+}
+
+} // psin
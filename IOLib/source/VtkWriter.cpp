@@ -0,0 +1,206 @@
+#include <VtkWriter.hpp>
+
+// IOLib
+#include <TrajectoryFormat.hpp>
+
+// Standard
+#include <cstdint>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace psin {
+
+namespace {
+
+// Values of an array that is written to the appended data block, already converted to its VTK type
+struct AppendedArray
+{
+	string type;
+	std::vector<char> bytes;
+};
+
+template<typename T>
+AppendedArray appended(const string & type, const std::vector<T> & values)
+{
+	AppendedArray array{type, std::vector<char>(values.size() * sizeof(T))};
+	if(not values.empty())
+	{
+		std::copy_n(reinterpret_cast<const char *>(values.data()), array.bytes.size(), array.bytes.data());
+	}
+	return array;
+}
+
+// Time instants are written with every digit that tells them apart
+string timeText(const double time)
+{
+	char text[32];
+	std::snprintf(text, sizeof(text), "%.17g", time);
+	return text;
+}
+
+void writeDataArray(std::ofstream & file, const vtk::DataArray & array, std::vector<AppendedArray> & appendedArrays, std::uint64_t & offset)
+{
+	file << "\t\t\t\t<DataArray type=\"Float64\" Name=\"" << array.name << "\" NumberOfComponents=\"" << array.components
+		<< "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+
+	appendedArrays.push_back( appended("Float64", array.values) );
+	offset += sizeof(std::uint64_t) + appendedArrays.back().bytes.size();
+}
+
+// Cells are given as VTK does: the points of every cell one after the other in connectivity,
+// where each cell ends in offsets, and each cell's VTK type in types
+void writeUnstructuredGrid(
+	const path & filePath,
+	const std::vector<double> & points,
+	const std::vector<std::int64_t> & connectivity,
+	const std::vector<std::int64_t> & offsets,
+	const std::vector<std::uint8_t> & types,
+	const std::vector<vtk::DataArray> & pointData,
+	const std::vector<vtk::DataArray> & cellData)
+{
+	std::ofstream file(filePath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(not file)
+	{
+		throw std::runtime_error("Could not open VTK file " + filePath.string());
+	}
+
+	std::vector<AppendedArray> appendedArrays;
+	std::uint64_t offset = 0;
+
+	file << "<?xml version=\"1.0\"?>\n"
+		<< "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+		<< (trajectory::nativeByteOrder() == "little" ? "LittleEndian" : "BigEndian")
+		<< "\" header_type=\"UInt64\">\n"
+		<< "\t<UnstructuredGrid>\n"
+		<< "\t\t<Piece NumberOfPoints=\"" << points.size() / 3 << "\" NumberOfCells=\"" << types.size() << "\">\n";
+
+	file << "\t\t\t<PointData>\n";
+	for(const vtk::DataArray & array : pointData) writeDataArray(file, array, appendedArrays, offset);
+	file << "\t\t\t</PointData>\n";
+
+	file << "\t\t\t<CellData>\n";
+	for(const vtk::DataArray & array : cellData) writeDataArray(file, array, appendedArrays, offset);
+	file << "\t\t\t</CellData>\n";
+
+	file << "\t\t\t<Points>\n";
+	writeDataArray(file, vtk::DataArray{"Points", 3, points}, appendedArrays, offset);
+	file << "\t\t\t</Points>\n";
+
+	file << "\t\t\t<Cells>\n";
+	const std::vector<AppendedArray> cells{ appended("Int64", connectivity), appended("Int64", offsets), appended("UInt8", types) };
+	const char * cellArrayNames[] = {"connectivity", "offsets", "types"};
+	for(std::size_t i = 0; i < cells.size(); ++i)
+	{
+		file << "\t\t\t\t<DataArray type=\"" << cells[i].type << "\" Name=\"" << cellArrayNames[i]
+			<< "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+
+		appendedArrays.push_back(cells[i]);
+		offset += sizeof(std::uint64_t) + cells[i].bytes.size();
+	}
+	file << "\t\t\t</Cells>\n";
+
+	file << "\t\t</Piece>\n"
+		<< "\t</UnstructuredGrid>\n"
+		<< "\t<AppendedData encoding=\"raw\">\n"
+		<< "_";
+
+	// Each array is preceded by its number of bytes
+	for(const AppendedArray & array : appendedArrays)
+	{
+		const std::uint64_t size = array.bytes.size();
+		file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+		file.write(array.bytes.data(), array.bytes.size());
+	}
+
+	file << "\n\t</AppendedData>\n"
+		<< "</VTKFile>\n";
+
+	if(not file)
+	{
+		throw std::runtime_error("Could not write VTK file " + filePath.string());
+	}
+}
+
+// VTK cell types
+constexpr std::uint8_t vertexCell = 1;
+constexpr std::uint8_t polygonCell = 7;
+
+} // anonymous namespace
+
+void vtk::writePointCloud(const path & filePath, const std::vector<double> & points, const std::vector<DataArray> & pointData)
+{
+	const std::size_t numberOfPoints = points.size() / 3;
+
+	std::vector<std::int64_t> connectivity(numberOfPoints);
+	std::vector<std::int64_t> offsets(numberOfPoints);
+	for(std::size_t point = 0; point < numberOfPoints; ++point)
+	{
+		connectivity[point] = point;
+		offsets[point] = point + 1;
+	}
+
+	writeUnstructuredGrid(filePath, points, connectivity, offsets, std::vector<std::uint8_t>(numberOfPoints, vertexCell), pointData, {});
+}
+
+void vtk::writePolygons(const path & filePath, const std::vector<double> & points, const std::vector< std::vector<std::size_t> > & polygons, const std::vector<DataArray> & cellData)
+{
+	std::vector<std::int64_t> connectivity;
+	std::vector<std::int64_t> offsets;
+	for(const auto & polygon : polygons)
+	{
+		connectivity.insert(connectivity.end(), polygon.begin(), polygon.end());
+		offsets.push_back(connectivity.size());
+	}
+
+	writeUnstructuredGrid(filePath, points, connectivity, offsets, std::vector<std::uint8_t>(polygons.size(), polygonCell), {}, cellData);
+}
+
+void VtkSeriesWriter::open(const path & filePath)
+{
+	this->filePath = filePath;
+	this->dataSets.clear();
+	this->opened = true;
+	this->flush();
+}
+
+bool VtkSeriesWriter::isOpen() const
+{
+	return this->opened;
+}
+
+void VtkSeriesWriter::add(const double time, const path & dataSetPath)
+{
+	this->dataSets.push_back( DataSet{time, dataSetPath} );
+}
+
+// The whole file is written again, so that it is always a complete XML document
+void VtkSeriesWriter::flush()
+{
+	if(not this->isOpen()) return;
+
+	std::ofstream file(this->filePath.string(), std::ios::out | std::ios::trunc);
+	file << "<?xml version=\"1.0\"?>\n"
+		<< "<VTKFile type=\"Collection\" version=\"0.1\">\n"
+		<< "\t<Collection>\n";
+	for(const DataSet & dataSet : this->dataSets)
+	{
+		file << "\t\t<DataSet timestep=\"" << timeText(dataSet.time) << "\" part=\"0\" file=\"" << dataSet.filePath.generic_string() << "\"/>\n";
+	}
+	file << "\t</Collection>\n"
+		<< "</VTKFile>\n";
+
+	if(not file)
+	{
+		throw std::runtime_error("Could not write VTK series file " + this->filePath.string());
+	}
+}
+
+void VtkSeriesWriter::close()
+{
+	this->flush();
+	this->opened = false;
+}
+
+} // psin
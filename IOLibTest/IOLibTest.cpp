@@ -20,18 +20,35 @@
 #include <SphericalParticle.hpp>
 
 // IOLib
+#include <AsyncWriter.hpp>
+#include <Checkpoint.hpp>
+#include <CompressedFrameReader.hpp>
+#include <CompressedFrameWriter.hpp>
 #include <FileReader.hpp>
+#include <FrameReader.hpp>
+#include <FrameWriter.hpp>
+#include <IndexedJsonReader.hpp>
+#include <JsonLinesReader.hpp>
+#include <OutputBuffer.hpp>
+#include <TimeIndexWriter.hpp>
+#include <TrajectoryReader.hpp>
+#include <TrajectoryWriter.hpp>
+#include <VtkWriter.hpp>
 #include <vectorIO.hpp>
 
 // PropertyLib
 #include <PropertyDefinitions.hpp>
 
+// Standard
+#include <cstring>
+#include <iterator>
+
 using namespace std;
 using namespace psin;
 
 TestCase( VectorVector3DTest )
 {
-	path projectRootPath = filesystem::current_path().parent_path().parent_path().parent_path();	
+	path projectRootPath = psin::filesystem::current_path().parent_path().parent_path().parent_path();	
 	program_options::options_description desc("Allowed options");
 	desc.add_options()
 		("help", "produce help message")
@@ -206,7 +223,7 @@ TestCase( VectorVector3DTest )
 
 TestCase( FileReaderTest )
 {
-	path projectRootPath = filesystem::current_path().parent_path().parent_path().parent_path();	
+	path projectRootPath = psin::filesystem::current_path().parent_path().parent_path().parent_path();	
 	program_options::options_description desc("Allowed options");
 	desc.add_options()
 		("help", "produce help message")
@@ -477,6 +494,330 @@ TestCase( IntVectorInput ){
 	inFile.close();
 }
 
+TestCase( TrajectoryWriterAndReader )
+{
+	path fileName = "trajectory.bin";
+	const vector<TrajectoryField> fields{ {"Position", 3}, {"Energy", 1, trajectory::float32Type} };
+
+	{
+		TrajectoryWriter writer(fileName, fields, json{ {"Name", "P1"} });
+		checkEqual(writer.getRecordSize(), 6);
+		checkEqual(writer.getRecordBytes(), 5 * sizeof(double) + sizeof(float));
+
+		for(long timeIndex = 0; timeIndex < 10; ++timeIndex)
+		{
+			const double values[] = {1.0 * timeIndex, 2.0, 3.0, 0.5 * timeIndex};
+			writer.append(10 * timeIndex, 0.1 * timeIndex, values);
+
+			if(timeIndex % 4 == 3) writer.flush();	// chunks of 4, 4 and 2 records
+		}
+	}
+
+	TrajectoryReader reader(fileName);
+	checkEqual(reader.getHeader().at("Name").get<string>(), "P1");
+	checkEqual(reader.getNumberOfRecords(), 10);
+	checkEqual(reader.getFields().back().type, trajectory::float32Type);
+	checkEqual(reader.getFieldOffset("Energy"), 5);
+
+	const vector<double> record = reader.readRecord(5);
+	checkEqual(record[0], 50);
+	checkEqual(record[2], 5.0);
+	checkEqual(record[5], 2.5);
+
+	const vector<double> energy = reader.readField("Energy", 2, 9);
+	checkEqual(energy.size(), 7);
+	for(std::size_t i = 0; i < energy.size(); ++i)
+	{
+		checkEqual(energy[i], 0.5 * (i + 2));
+	}
+
+	checkEqual(reader.findTimeIndex(70), 7);
+	checkEqual(reader.findTimeIndex(71), 8);
+	checkEqual(reader.findTime(0.0), 0);
+	checkEqual(reader.findTime(5.0), 10);
+}
+
+TestCase( FrameWriterAndReader )
+{
+	path fileName = "frames.bin";
+	const vector<FrameEntity> entities{
+		{"P1", { {"Position", 3}, {"Energy", 1, trajectory::float32Type} }},
+		{"P2", { {"Position", 3} }, json{ {"particleType", "SphericalParticle"} }}
+	};
+
+	{
+		FrameWriter writer(fileName, entities);
+		checkEqual(writer.getFrameSize(), 9);
+		checkEqual(writer.getFrameBytes(), 8 * sizeof(double) + sizeof(float));
+
+		for(long timeIndex = 0; timeIndex < 5; ++timeIndex)
+		{
+			const double values[] = {1.0 * timeIndex, 2.0, 3.0, 0.5 * timeIndex, -1.0 * timeIndex, -2.0, -3.0};
+			writer.append(10 * timeIndex, 0.1 * timeIndex, values);
+		}
+	}
+
+	// A frame cut short is not read
+	std::ofstream(fileName.string(), std::ios::app | std::ios::binary) << "partial";
+
+	FrameReader reader(fileName);
+	checkEqual(reader.getNumberOfFrames(), 5);
+	checkEqual(reader.getEntityIndex("P2"), 1);
+	checkEqual(reader.getEntities()[1].description.at("particleType").get<string>(), "SphericalParticle");
+	checkEqual(reader.getFieldOffset(1, "Position"), 6);
+
+	const vector<double> frame = reader.readFrame(3);
+	checkEqual(frame.size(), 9);
+	checkEqual(frame[0], 30);
+	checkEqual(frame[5], 1.5);
+	checkEqual(frame[6], -3.0);
+
+	const vector<double> position = reader.readField(1, "Position", 1, 4);
+	checkEqual(position.size(), 9);
+	checkEqual(position[3], -2.0);
+	checkEqual(position[4], -2.0);
+
+	checkEqual(reader.findTimeIndex(25), 3);
+	checkEqual(reader.findTime(0.0), 0);
+	BOOST_CHECK_THROW(reader.getEntityIndex("P3"), std::runtime_error);
+}
+
+TestCase( CompressedFrameWriterAndReader )
+{
+	path fileName = "frames.delta";
+	const double tolerance = 1e-3;
+	const vector<FrameEntity> entities{
+		{"P1", { {"Position", 3, trajectory::float64Type, tolerance}, {"Energy", 1} }},
+		{"P2", { {"Position", 3, trajectory::float64Type, tolerance} }}
+	};
+
+	auto valuesOf = [](const long timeIndex){
+		return vector<double>{0.1234567 * timeIndex, 2.0, 3.0, 1.0 / (timeIndex + 3), -std::sqrt(timeIndex), -2.0, 1e6};
+	};
+
+	{
+		CompressedFrameWriter writer;
+		writer.open(fileName, entities, 4);
+		checkEqual(writer.getFrameSize(), 9);
+
+		for(long timeIndex = 0; timeIndex < 10; ++timeIndex)
+		{
+			writer.append(10 * timeIndex, 0.1 * timeIndex, valuesOf(timeIndex).data());
+		}
+	}
+
+	// A record cut short is not read
+	std::ofstream(fileName.string(), std::ios::app | std::ios::binary) << "partial";
+
+	CompressedFrameReader reader(fileName);
+	checkEqual(reader.getNumberOfFrames(), 10);
+	checkEqual(reader.getHeader().at("KeyframeInterval"), 4);
+	checkEqual(reader.getEntities()[0].fields[0].tolerance, tolerance);
+	checkEqual(reader.getFieldOffset(1, "Position"), 6);
+
+	// Frames are rebuilt whatever the order they are read in
+	for(long timeIndex : {7, 2, 3, 9, 0, 5})
+	{
+		const vector<double> frame = reader.readFrame(timeIndex);
+		const vector<double> values = valuesOf(timeIndex);
+		checkEqual(frame.size(), 9);
+		checkEqual(frame[0], 10 * timeIndex);
+		checkEqual(frame[1], 0.1 * timeIndex);
+		checkEqual(frame[5], values[3]);
+		for(std::size_t value = 0; value < values.size(); ++value)
+		{
+			check(std::abs(frame[value + 2] - values[value]) <= tolerance);
+		}
+	}
+
+	checkEqual(reader.findTimeIndex(25), 3);
+	checkEqual(reader.findTime(0.0), 0);
+	BOOST_CHECK_THROW(reader.readFrame(10), std::out_of_range);
+}
+
+TestCase( AsyncWriterTest )
+{
+	vector<int> written;
+	{
+		AsyncWriter writer(2);
+		checkEqual(writer.getCapacity(), 2);
+
+		for(int i = 0; i < 100; ++i)
+		{
+			writer.push([&written, i](){ written.push_back(i); });
+		}
+		writer.wait();
+		checkEqual(written.size(), 100);
+		for(int i = 0; i < 100; ++i)
+		{
+			checkEqual(written[i], i);
+		}
+
+		writer.push([](){ throw std::runtime_error("Disk full"); });
+		BOOST_CHECK_THROW(writer.wait(), std::runtime_error);
+
+		writer.push([&written](){ written.push_back(100); });
+		BOOST_CHECK_THROW(writer.setCapacity(0), std::runtime_error);
+	}
+	checkEqual(written.size(), 101);
+}
+
+TestCase( OutputBufferTest )
+{
+	OutputBuffer buffer(10 * sizeof(double));
+	check(buffer.empty());
+
+	buffer.append(OutputBuffer::Frame{0.0, 1.0, 2.0, 3.0});
+	buffer.append(OutputBuffer::Frame{1.0, 2.0, 3.0, 4.0});
+	checkEqual(buffer.getSize(), 8 * sizeof(double));
+	check(!buffer.isFull());
+
+	buffer.append(OutputBuffer::Frame{2.0, 3.0, 4.0, 5.0});
+	check(buffer.isFull());
+	checkEqual(buffer.getFrames().size(), 3);
+	checkEqual(buffer.getFrames()[1][3], 4.0);
+
+	buffer.clear();
+	check(buffer.empty());
+	checkEqual(buffer.getSize(), 0);
+	BOOST_CHECK_THROW(buffer.setByteBudget(0), std::runtime_error);
+}
+
+TestCase( TimeIndexTest )
+{
+	const path streamPath = psin::filesystem::temp_directory_path() / path("IOLibTest_stream.json");
+	{
+		std::fstream stream(streamPath.string(), std::ios::in | std::ios::out | std::ios::trunc);
+		TimeIndexWriter index;
+		index.open(timeindex::indexPathOf(streamPath));
+
+		stream << "[";
+		for(int i = 0; i < 10; ++i)
+		{
+			stream << (i == 0 ? "\n" : ",\n");
+			index.append(100 * i, 0.5 * i, stream);
+			stream << json{ {"timeIndex", 100 * i}, {"values", {i, -i}} }.dump(4);
+		}
+		stream << "]" << endl;
+	}
+
+	IndexedJsonReader reader(streamPath);
+	checkEqual(reader.getNumberOfEntries(), 10);
+	checkEqual(reader.getIndex().getEntry(3).timeIndex, 300);
+	checkEqual(reader.getIndex().findTime(1.2), 3);
+	checkEqual(reader.getIndex().findTimeIndex(1000), 10);
+
+	checkEqual(reader.readEntry(0).at("timeIndex"), 0);
+	checkEqual(reader.readAtTimeIndex(700).at("values")[1], -7);
+	checkEqual(reader.readAtTime(4.5).at("timeIndex"), 900);
+	BOOST_CHECK_THROW(reader.readAtTimeIndex(150), std::runtime_error);
+	BOOST_CHECK_THROW(reader.readAtTime(4.6), std::runtime_error);
+
+	psin::filesystem::remove(streamPath);
+	psin::filesystem::remove(timeindex::indexPathOf(streamPath));
+}
+
+TestCase( JsonLinesReaderTest )
+{
+	const path filePath = psin::filesystem::temp_directory_path() / path("IOLibTest_stream.jsonl");
+	std::ofstream writer(filePath.string(), std::ios::out | std::ios::trunc);
+	JsonLinesReader reader(filePath);
+
+	writer << json{ {"timeIndex", 0} }.dump() << '\n' << "{\"timeIndex\": " << std::flush;
+	vector<json> entries = reader.readAvailable();
+	checkEqual(entries.size(), 1);
+	checkEqual(entries[0].at("timeIndex"), 0);
+
+	// The entry cut short above is only read once its line is complete
+	check(reader.readAvailable().empty());
+	writer << "100}\n\n" << json{ {"timeIndex", 200} }.dump() << '\n' << std::flush;
+	entries = reader.readAvailable();
+	checkEqual(entries.size(), 2);
+	checkEqual(entries[1].at("timeIndex"), 200);
+	checkEqual(reader.getNumberOfEntriesRead(), 3);
+
+	writer << "{\"timeIndex\": 300,\n" << std::flush;
+	BOOST_CHECK_THROW(reader.readAvailable(), std::exception);
+
+	writer.close();
+	psin::filesystem::remove(filePath);
+}
+
+TestCase( VtkWriterTest )
+{
+	const path folder = psin::filesystem::temp_directory_path();
+	const vector<double> points{0.0, 0.0, 0.0, 1.0, 2.0, 3.0};
+
+	vtk::writePointCloud(folder / path("IOLibTest_cloud.vtu"), points, { {"Radius", 1, {0.5, 0.25}} });
+
+	std::ifstream file((folder / path("IOLibTest_cloud.vtu")).string(), std::ios::binary);
+	const string text{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	check(text.find("NumberOfPoints=\"2\" NumberOfCells=\"2\"") != string::npos);
+	check(text.find("Name=\"Radius\" NumberOfComponents=\"1\" format=\"appended\" offset=\"0\"") != string::npos);
+
+	// Radii come first in the appended data, after their byte count
+	const std::size_t data = text.find('_', text.find("<AppendedData")) + 1;
+	std::uint64_t bytes;
+	double radius;
+	std::memcpy(&bytes, text.data() + data, sizeof(bytes));
+	std::memcpy(&radius, text.data() + data + sizeof(bytes) + sizeof(double), sizeof(radius));
+	checkEqual(bytes, 2 * sizeof(double));
+	checkEqual(radius, 0.25);
+
+	VtkSeriesWriter series;
+	series.open(folder / path("IOLibTest_series.pvd"));
+	series.add(0.5, path("IOLibTest_cloud.vtu"));
+	series.close();
+
+	std::ifstream seriesFile((folder / path("IOLibTest_series.pvd")).string());
+	const string seriesText{std::istreambuf_iterator<char>(seriesFile), std::istreambuf_iterator<char>()};
+	check(seriesText.find("<DataSet timestep=\"0.5\" part=\"0\" file=\"IOLibTest_cloud.vtu\"/>") != string::npos);
+
+	psin::filesystem::remove(folder / path("IOLibTest_cloud.vtu"));
+	psin::filesystem::remove(folder / path("IOLibTest_series.pvd"));
+}
+
+TestCase( CheckpointTest )
+{
+	const path filePath = psin::filesystem::temp_directory_path() / path("IOLibTest_checkpoint.bin");
+	const double time = 0.1 + 0.2;	// not exactly representable in decimal
+	const vector< pair<pair<int, int>, Vector3D> > entries{ {{1, 2}, Vector3D(1.0, 2.0, 3.0)}, {{4, 3}, Vector3D(-1.0, 1.0/3.0, 0.0)} };
+	const tuple<size_t, double> counters{7, 1e-300};
+
+	{
+		CheckpointWriter writer(filePath, json{ {"timeIndex", 12} });
+		writer.write(time);
+		writer.write(entries);
+		writer.write(counters);
+		writer.commit();
+	}
+	{
+		CheckpointWriter writer(filePath, json{ {"timeIndex", 13} });
+		writer.write(0.0);
+		// Not committed: the first checkpoint must survive
+	}
+
+	CheckpointReader reader(filePath);
+	checkEqual(reader.getHeader().at("timeIndex"), 12);
+
+	double readTime;
+	vector< pair<pair<int, int>, Vector3D> > readEntries;
+	tuple<size_t, double> readCounters;
+	reader.read(readTime);
+	reader.read(readEntries);
+	reader.read(readCounters);
+
+	checkEqual(readTime, time);
+	checkEqual(readEntries.size(), 2);
+	checkEqual(readEntries[1].first.first, 4);
+	checkEqual(readEntries[1].second, entries[1].second);
+	check(readCounters == counters);
+	BOOST_CHECK_THROW(reader.read(readTime), std::runtime_error);
+
+	psin::filesystem::remove(filePath);
+	BOOST_CHECK_THROW(CheckpointReader reader(filePath), std::runtime_error);
+}
+
 // TestCase( Vector3DIO ){
 // 	string fileName("../UtilsLibTest/fileVector3D.txt");
 
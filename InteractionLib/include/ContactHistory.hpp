@@ -0,0 +1,108 @@
+#ifndef CONTACT_HISTORY_HPP
+#define CONTACT_HISTORY_HPP
+
+// EntityLib
+#include <HandledEntity.hpp>
+
+// Standard
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace psin {
+
+// ContactHistory stores a Value for each pair of entities in contact, keyed by their ordered
+// handle pair (see makeHandlePair). It is an open-addressing hash table with linear probing.
+//
+// Entries live for as long as they are touched: age() is called once per time step and drops
+// every entry that was not touched since the previous call, which are contacts that ended.
+// Rebuilding the table there also keeps probe sequences short, since nothing is ever erased
+// in between.
+template<typename Value>
+class ContactHistory
+{
+	public:
+		using value_type = Value;
+
+		explicit ContactHistory(const std::size_t initialCapacity = 16);
+
+		// Returns the pair's entry, or nullptr if the pair has no history
+		Value * find(const handle_pair & pair);
+		const Value * find(const handle_pair & pair) const;
+		Value * find(const HandledEntity & left, const HandledEntity & right);
+
+		// Returns the pair's entry, inserting a value-initialized one if the pair has no history,
+		// and keeps it alive through the next call to age()
+		Value & touch(const handle_pair & pair);
+		Value & touch(const HandledEntity & left, const HandledEntity & right);
+
+		// Drops entries that were not touched since the last call and compacts the table
+		void age();
+
+		// Calls function(pair, value) for every entry
+		template<typename Function>
+		void for_each(Function && function) const;
+
+		// Sets the pair's entry without keeping it alive through the next call to age(), as when
+		// restoring a saved history
+		void restore(const handle_pair & pair, const Value & value);
+
+		void clear();
+
+		std::size_t size() const;
+		std::size_t capacity() const;
+
+	private:
+		struct Slot
+		{
+			handle_pair key;
+			Value value;
+			bool occupied = false;
+			bool touched = false;
+		};
+
+		std::size_t slotOf(const handle_pair & pair) const; // first slot holding pair or the empty slot ending its probe sequence
+		// Moves the entries into a table of newCapacity slots; when aging, untouched entries are dropped and touched ones are reset
+		void rehash(const std::size_t newCapacity, const bool aging);
+
+		std::vector<Slot> slots;
+		std::vector<Slot> buffer;	// reused by rehash, so that aging does not allocate
+		std::size_t numberOfEntries = 0;
+		std::size_t minimumCapacity;
+};
+
+// Interactions whose forces depend on the past of a contact declare their per-contact state as
+// 	using contact_history_type = ...;
+// The Simulator then keeps a ContactHistory of that type and passes it as the last argument of calculate.
+template<typename T, typename SFINAE = void>
+struct has_contact_history : std::false_type {};
+
+template<typename T>
+struct has_contact_history<
+		T,
+		std::void_t<typename T::contact_history_type>
+	>
+	: std::true_type
+{};
+
+// InteractionContactHistory<I> is the history owned on behalf of interaction I, so that histories
+// of different interactions are distinct types even when they store the same Value.
+template<typename InteractionType, typename SFINAE = void>
+struct InteractionContactHistory
+{
+	void age() {}
+};
+
+template<typename InteractionType>
+struct InteractionContactHistory<
+		InteractionType,
+		std::enable_if_t<has_contact_history<InteractionType>::value>
+	>
+	: public ContactHistory<typename InteractionType::contact_history_type>
+{};
+
+} // psin
+
+#include <ContactHistory.tpp>
+
+#endif // CONTACT_HISTORY_HPP
@@ -0,0 +1,164 @@
+#ifndef CONTACT_HISTORY_TPP
+#define CONTACT_HISTORY_TPP
+
+// Standard
+#include <algorithm>
+
+namespace psin {
+
+template<typename Value>
+ContactHistory<Value>::ContactHistory(const std::size_t initialCapacity)
+	: minimumCapacity(16)
+{
+	while(this->minimumCapacity < initialCapacity) this->minimumCapacity *= 2;
+
+	this->slots.resize(this->minimumCapacity);
+}
+
+template<typename Value>
+std::size_t ContactHistory<Value>::slotOf(const handle_pair & pair) const
+{
+	const std::size_t mask = this->slots.size() - 1;	// the capacity is a power of two
+
+	std::size_t index = handle_pair_hash()(pair) & mask;
+	while(this->slots[index].occupied and this->slots[index].key != pair)
+	{
+		index = (index + 1) & mask;
+	}
+
+	return index;
+}
+
+template<typename Value>
+Value * ContactHistory<Value>::find(const handle_pair & pair)
+{
+	Slot & slot = this->slots[ this->slotOf(pair) ];
+
+	return slot.occupied ? &slot.value : nullptr;
+}
+
+template<typename Value>
+const Value * ContactHistory<Value>::find(const handle_pair & pair) const
+{
+	const Slot & slot = this->slots[ this->slotOf(pair) ];
+
+	return slot.occupied ? &slot.value : nullptr;
+}
+
+template<typename Value>
+Value * ContactHistory<Value>::find(const HandledEntity & left, const HandledEntity & right)
+{
+	return this->find( makeHandlePair(left, right) );
+}
+
+template<typename Value>
+Value & ContactHistory<Value>::touch(const handle_pair & pair)
+{
+	std::size_t index = this->slotOf(pair);
+
+	if(not this->slots[index].occupied)
+	{
+		// Keep the load factor at most 1/2
+		if( 2 * (this->numberOfEntries + 1) > this->slots.size() )
+		{
+			this->rehash( 2 * this->slots.size(), false );
+			index = this->slotOf(pair);
+		}
+
+		Slot & slot = this->slots[index];
+		slot.key = pair;
+		slot.value = Value();
+		slot.occupied = true;
+		++this->numberOfEntries;
+	}
+
+	Slot & slot = this->slots[index];
+	slot.touched = true;
+
+	return slot.value;
+}
+
+template<typename Value>
+Value & ContactHistory<Value>::touch(const HandledEntity & left, const HandledEntity & right)
+{
+	return this->touch( makeHandlePair(left, right) );
+}
+
+template<typename Value>
+void ContactHistory<Value>::age()
+{
+	std::size_t touchedEntries = 0;
+	for(const Slot & slot : this->slots)
+	{
+		if(slot.occupied and slot.touched) ++touchedEntries;
+	}
+
+	// Shrinks the table when most contacts ended, but never below its initial capacity
+	std::size_t newCapacity = this->slots.size();
+	while(newCapacity > this->minimumCapacity and 8 * touchedEntries < newCapacity)
+	{
+		newCapacity /= 2;
+	}
+
+	this->rehash(newCapacity, true);
+}
+
+template<typename Value>
+template<typename Function>
+void ContactHistory<Value>::for_each(Function && function) const
+{
+	for(const Slot & slot : this->slots)
+	{
+		if(slot.occupied) function(slot.key, slot.value);
+	}
+}
+
+template<typename Value>
+void ContactHistory<Value>::restore(const handle_pair & pair, const Value & value)
+{
+	this->touch(pair) = value;
+	this->slots[ this->slotOf(pair) ].touched = false;
+}
+
+template<typename Value>
+void ContactHistory<Value>::rehash(const std::size_t newCapacity, const bool aging)
+{
+	this->buffer.swap(this->slots);
+	this->slots.assign(newCapacity, Slot());
+	this->numberOfEntries = 0;
+
+	for(Slot & slot : this->buffer)
+	{
+		if(not slot.occupied or (aging and not slot.touched)) continue;
+
+		Slot & newSlot = this->slots[ this->slotOf(slot.key) ];
+		newSlot.key = slot.key;
+		newSlot.value = std::move(slot.value);
+		newSlot.occupied = true;
+		newSlot.touched = not aging and slot.touched;
+		++this->numberOfEntries;
+	}
+}
+
+template<typename Value>
+void ContactHistory<Value>::clear()
+{
+	this->slots.assign(this->minimumCapacity, Slot());
+	this->numberOfEntries = 0;
+}
+
+template<typename Value>
+std::size_t ContactHistory<Value>::size() const
+{
+	return this->numberOfEntries;
+}
+
+template<typename Value>
+std::size_t ContactHistory<Value>::capacity() const
+{
+	return this->slots.size();
+}
+
+} // psin
+
+#endif // CONTACT_HISTORY_TPP
@@ -4,7 +4,10 @@
 // // UtilsLib
 #include <Named.hpp>
 // #include <SharedPointer.hpp>
+#include <mp/bool_constant.hpp>
+#include <mp/metafunction.hpp>
 #include <mp/type_collection.hpp>
+#include <mp/type_list.hpp>
 #include <Vector3D.hpp>
 
 // // EntityLib
@@ -14,6 +17,8 @@
 // #include <Property.hpp>
 
 // Standard
+#include <array>
+#include <cstddef>
 #include <type_traits>
 #include <vector>
 
@@ -102,10 +107,56 @@ class Interaction<>
 	public:
 		static vector<Vector3D> taylorPredictor( const vector<Vector3D> & currentVector, const int predictionOrder, const double dt );
 		static vector<Vector3D> gearCorrector(const vector<Vector3D> & predictedVector, const Vector3D & doubleDerivative, const int equationOrder, const int predictionOrder, const double dt);
+
+		// Gear's corrector constants, in the form used by gearCorrector
+		static vector<double> gearCorrectorConstants(const int equationOrder, const int predictionOrder); // throws
+
+		// In-place versions for Taylor matrices whose order is known at compile time.
+		// Matrix may be any type whose entries are accessed as matrix[derivative], such as
+		// FixedOrderSpatialEntity's std::arrays. They never allocate.
+
+		// taylorCoefficients<PredictionOrder>(dt)[k] == dt^k / k!
+		template<std::size_t PredictionOrder>
+		static std::array<double, PredictionOrder + 1> taylorCoefficients(const double dt);
+
+		template<std::size_t PredictionOrder, typename Matrix, typename Coefficients>
+		static void taylorPredict(Matrix && matrix, const Coefficients & coefficients);
+
+		// gearCorrectorFactors<EquationOrder, PredictionOrder>(dt)[k] multiplies the difference between the
+		// computed and the predicted EquationOrder-th derivative when correcting the k-th derivative
+		template<std::size_t EquationOrder, std::size_t PredictionOrder>
+		static std::array<double, PredictionOrder + 1> gearCorrectorFactors(const double dt); // throws
+
+		template<std::size_t EquationOrder, std::size_t PredictionOrder, typename Matrix, typename Factors>
+		static void gearCorrect(Matrix && matrix, const Vector3D & derivative, const Factors & factors);
 	private:
 
 };
 
+// Contact interactions only act between entities that touch each other.
+// Seekers may skip distant pairs for them; any other interaction is evaluated for every pair.
+template<typename T, typename SFINAE = void>
+struct is_contact_interaction : std::false_type {};
+
+template<typename T>
+struct is_contact_interaction<
+		T,
+		std::enable_if_t<T::is_contact_interaction or not T::is_contact_interaction>
+	>
+	: mp::bool_constant<T::is_contact_interaction>
+{};
+
+// Properties that an interaction reads with getUnchecked, listed by its member type_list properties.
+// The simulator checks once, before the time loop, that they are assigned in every entity the
+// interaction acts on that has them.
+template<typename T, typename SFINAE = void>
+struct interaction_properties : mp::metafunction< mp::type_list<> > {};
+
+template<typename T>
+struct interaction_properties< T, std::void_t<typename T::properties> >
+	: mp::metafunction<typename T::properties>
+{};
+
 } // psin
 
 #include <Interaction.tpp>
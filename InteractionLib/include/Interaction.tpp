@@ -1,6 +1,64 @@
 #ifndef INTERACTION_TPP
 #define INTERACTION_TPP
 
+// UtilsLib
+#include <Mathematics.hpp>
+
+namespace psin {
+
+template<std::size_t PredictionOrder>
+std::array<double, PredictionOrder + 1> Interaction<>::taylorCoefficients(const double dt)
+{
+	std::array<double, PredictionOrder + 1> coefficients;
+	for(int k = 0; k <= static_cast<int>(PredictionOrder); ++k)
+	{
+		coefficients[k] = pow( dt , k ) / factorial( k );
+	}
+	return coefficients;
+}
+
+// Same expansion as taylorPredictor: since the i-th derivative only depends on derivatives of order
+// i or higher, computing them in increasing order allows overwriting the matrix
+template<std::size_t PredictionOrder, typename Matrix, typename Coefficients>
+void Interaction<>::taylorPredict(Matrix && matrix, const Coefficients & coefficients)
+{
+	for(std::size_t i = 0; i <= PredictionOrder; ++i)
+	{
+		Vector3D taylorExpansion = matrix[i];
+		for(std::size_t j = i + 1; j <= PredictionOrder; ++j)
+		{
+			taylorExpansion += coefficients[j - i] * matrix[j];
+		}
+		matrix[i] = taylorExpansion;
+	}
+}
+
+template<std::size_t EquationOrder, std::size_t PredictionOrder>
+std::array<double, PredictionOrder + 1> Interaction<>::gearCorrectorFactors(const double dt)
+{
+	const std::vector<double> correctorConstants = gearCorrectorConstants(EquationOrder, PredictionOrder);
+	const int equationOrder = EquationOrder;
+
+	std::array<double, PredictionOrder + 1> factors;
+	for(int i = 0; i <= static_cast<int>(PredictionOrder); ++i)
+	{
+		factors[i] = correctorConstants[i] * ( factorial(i) / pow(dt, i) ) * (pow(dt, equationOrder) / factorial(equationOrder));
+	}
+	return factors;
+}
+
+template<std::size_t EquationOrder, std::size_t PredictionOrder, typename Matrix, typename Factors>
+void Interaction<>::gearCorrect(Matrix && matrix, const Vector3D & derivative, const Factors & factors)
+{
+	const Vector3D difference = derivative - matrix[EquationOrder];
+	for(std::size_t i = 0; i <= PredictionOrder; ++i)
+	{
+		matrix[i] += factors[i] * difference;
+	}
+}
+
+} // psin
+
 // template<typename InterfaceType, typename StoredType>
 // void Interaction<SphericalParticle, SphericalParticle>::requireProperty( const Property<InterfaceType, StoredType> & property )
 // {
@@ -4,6 +4,9 @@
 // EntityLib
 #include <SphericalParticle.hpp>
 
+// InteractionLib
+#include <ContactHistory.hpp>
+
 // UtilsLib
 #include <Builder.hpp>
 #include <FileSystem.hpp>
@@ -26,13 +29,17 @@ namespace psin {
 struct CoefficientOfRestitutionCalculator
 {
 public:
-	using name_pair = std::pair<string, string>;
+	constexpr static bool is_contact_interaction = true;
+
 	using velocities_t = std::tuple<std::size_t, std::size_t, double, double>;
 	static constexpr auto initial_instant_idx = 0;
 	static constexpr auto final_instant_idx = 1;
 	static constexpr auto initial_velocity_idx = 2;
 	static constexpr auto final_velocity_idx = 3;
 
+	// Time indices and relative normal velocities at the beginning and at the end of the collision
+	using contact_history_type = velocities_t;
+
 	template<typename Particle, typename Neighbor>
 	struct check : mp::disjunction<
 			mp::conjunction<
@@ -48,30 +55,20 @@ public:
 	constexpr static bool check_v = check<Particle, Neighbor>::value;
 
 	template<typename Particle, typename Neighbor, typename Time>
-	static void calculate(const Particle & particle, const Neighbor & neighbor, const Time & t);
+	static void calculate(const Particle & particle, const Neighbor & neighbor, const Time & t, ContactHistory<contact_history_type> & history);
 
 	static void setFile(const path & filepath);
 
 	static void finish();
 private:
 	template<typename Particle, typename Neighbor, typename Time>
-	static void startCollision(const Particle & particle, const Neighbor & neighbor, const Time & t);
-
-	template<typename Particle, typename Neighbor>
-	static bool checkCollision(const Particle & particle, const Neighbor & neighbor);
+	static void startCollision(const Particle & particle, const Neighbor & neighbor, const Time & t, ContactHistory<contact_history_type> & history);
 
 	template<typename Particle, typename Neighbor, typename Time>
-	static void endCollision(const Particle & particle, const Neighbor & neighbor, const Time & t);
-	
-	static std::map<name_pair, bool> collisionFlag;
-	static std::map<name_pair, double> coefficientOfRestitution;
-	static std::map<name_pair, velocities_t> velocities;
+	static void endCollision(const Particle & particle, const Neighbor & neighbor, const Time & t, velocities_t & velocities);
 
 	static unique_ptr<std::fstream> file;
 
-	template<typename Particle, typename Neighbor>
-	static std::pair<string, string> makeNamePair(const Particle & particle, const Neighbor & neighbor);
-
 	static bool firstPrint;
 	static bool initialized;
 };
@@ -12,77 +12,57 @@
 
 namespace psin {
 
+// A collision lasts for as long as its history is touched: the first call after the entities
+// separate reports the collision and leaves its history to be dropped when the history ages
 template<typename Particle, typename Neighbor, typename Time>
-void CoefficientOfRestitutionCalculator::calculate(const Particle & particle, const Neighbor & neighbor, const Time & t)
+void CoefficientOfRestitutionCalculator::calculate(const Particle & particle, const Neighbor & neighbor, const Time & t, ContactHistory<contact_history_type> & history)
 {
-	if(checkCollision(particle, neighbor))
+	if(velocities_t * velocities = history.find(particle, neighbor))
 	{
 		if(not touch(particle, neighbor))
 		{
 			std::cout << "Ending collision between " << particle.getName() << " and " << neighbor.getName() << " at t=" << t.as_json().dump() << "s" << std::endl; // DEBUG
-			endCollision(particle, neighbor, t);
+			endCollision(particle, neighbor, t, *velocities);
 		}
 		else
 		{
-			std::get<final_velocity_idx>(velocities[ std::make_pair(particle.getName(), neighbor.getName()) ]) = psin::relativeNormalSpeedContactPoint(particle, neighbor);
+			std::get<final_velocity_idx>(history.touch(particle, neighbor)) = psin::relativeNormalSpeedContactPoint(particle, neighbor);
 		}
 	}
 	else if(touch(particle, neighbor))
 	{
 		std::cout << "Beginning collision between " << particle.getName() << " and " << neighbor.getName() << " at t=" << t.as_json().dump() << "s" << std::endl; // DEBUG
-		startCollision(particle, neighbor, t);
-	}
-}
-
-template<typename Particle, typename Neighbor>
-bool CoefficientOfRestitutionCalculator::checkCollision(const Particle & particle, const Neighbor & neighbor)
-{
-	string name1 = particle.getName();
-	string name2 = neighbor.getName();
-
-	if(collisionFlag.count( std::pair<string, string>(name1, name2) ) > 0)
-	{
-		return collisionFlag[ std::make_pair(name1, name2) ];
-	}
-	else
-	{
-		return false;
+		startCollision(particle, neighbor, t, history);
 	}
 }
 
 template<typename Particle, typename Neighbor, typename Time>
-void CoefficientOfRestitutionCalculator::startCollision(const Particle & particle, const Neighbor & neighbor, const Time & t)
+void CoefficientOfRestitutionCalculator::startCollision(const Particle & particle, const Neighbor & neighbor, const Time & t, ContactHistory<contact_history_type> & history)
 {
-	string name1 = particle.getName();
-	string name2 = neighbor.getName();
-
 	auto timeIndex = t.getIndex();
 	auto relativeNormalVelocity = psin::relativeNormalSpeedContactPoint(particle, neighbor);
 
-	collisionFlag[ std::make_pair(name1, name2) ] = true;
-	velocities[ std::make_pair(name1, name2) ] = std::make_tuple(timeIndex, timeIndex, relativeNormalVelocity, relativeNormalVelocity);
+	history.touch(particle, neighbor) = std::make_tuple(timeIndex, timeIndex, relativeNormalVelocity, relativeNormalVelocity);
 }
 
 template<typename Particle, typename Neighbor, typename Time>
-void CoefficientOfRestitutionCalculator::endCollision(const Particle & particle, const Neighbor & neighbor, const Time & t)
+void CoefficientOfRestitutionCalculator::endCollision(const Particle & particle, const Neighbor & neighbor, const Time & t, velocities_t & velocities)
 {
 	string name1 = particle.getName();
 	string name2 = neighbor.getName();
-	auto namePair = std::make_pair(name1, name2);
 
-	collisionFlag[ namePair ] = false;
-	std::get<final_instant_idx>(velocities[ namePair ]) = t.getIndex();
-	coefficientOfRestitution[namePair] = - std::get<final_velocity_idx>(velocities[ namePair ]) / std::get<initial_velocity_idx>(velocities[ namePair ]);
+	std::get<final_instant_idx>(velocities) = t.getIndex();
+	const double coefficientOfRestitution = - std::get<final_velocity_idx>(velocities) / std::get<initial_velocity_idx>(velocities);
 
 	json j{
 		{"pair", vector<string>{name1, name2}},
 		{"velocities", vector<double>{
-			std::get<initial_velocity_idx>(velocities[ namePair ]),
-			std::get<final_velocity_idx>(velocities[ namePair ])}},
+			std::get<initial_velocity_idx>(velocities),
+			std::get<final_velocity_idx>(velocities)}},
 		{"timeIndices", vector<typename Time::index_type>{
-			std::get<initial_instant_idx>(velocities[ namePair ]),
-			std::get<final_instant_idx>(velocities[ namePair ])}},
-		{"coefficientOfRestitution", coefficientOfRestitution[namePair]}
+			std::get<initial_instant_idx>(velocities),
+			std::get<final_instant_idx>(velocities)}},
+		{"coefficientOfRestitution", coefficientOfRestitution}
 	};
 
 	if(firstPrint)
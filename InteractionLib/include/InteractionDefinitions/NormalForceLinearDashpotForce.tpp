@@ -33,11 +33,11 @@ Vector3D NormalForceLinearDashpotForce::calculate(SphericalParticle<Ts...> & par
 		std::cout << "Positive overlap" << std::endl; // DEBUG
 
 		// ---- Get physical properties and calculate effective parameters ----
-		const double elasticModulus1 = particle.template get<ElasticModulus>();
-		const double elasticModulus2 = neighbor.template get<ElasticModulus>();
+		const double elasticModulus1 = particle.template getUnchecked<ElasticModulus>();
+		const double elasticModulus2 = neighbor.template getUnchecked<ElasticModulus>();
 		
-		const double normalDissipativeConstant1 = particle.template get<NormalDissipativeConstant>();
-		const double normalDissipativeConstant2 = neighbor.template get<NormalDissipativeConstant>();
+		const double normalDissipativeConstant1 = particle.template getUnchecked<NormalDissipativeConstant>();
+		const double normalDissipativeConstant2 = neighbor.template getUnchecked<NormalDissipativeConstant>();
 
 		const auto effectiveElasticModulus = reciprocalOfSumOfReciprocals(elasticModulus1, elasticModulus2);
 		const auto effectiveNormalDissipativeConstant = reciprocalOfSumOfReciprocals(normalDissipativeConstant1, normalDissipativeConstant2);
@@ -58,7 +58,7 @@ Vector3D NormalForceLinearDashpotForce::calculate(SphericalParticle<Ts...> & par
 
 		std::cout << "Setting normal force" << std::endl; // DEBUG
 		particle.setNormalForce(neighbor, normalForce);
-		std::cout << "Normal force between " << particle.getName() << " and " << neighbor.getName() << ": " << particle.getNormalForce(neighbor) << std::endl; // DEBUG
+		std::cout << "Normal force between " << particle.getName() << " and " << neighbor.getName() << ": " << normalForce << std::endl; // DEBUG
 
 		neighbor.setNormalForce(particle, - normalForce);
 
@@ -78,11 +78,11 @@ Vector3D NormalForceLinearDashpotForce::calculate(SphericalParticle<Ts...> & par
 		std::cout << "Interacting. Overlap: " << overlap << std::endl; // DEBUG
 
 		// ---- Get physical properties and calculate effective parameters ----
-		const double elasticModulus1 = particle.template get<ElasticModulus>();
-		const double elasticModulus2 = neighbor.template get<ElasticModulus>();
+		const double elasticModulus1 = particle.template getUnchecked<ElasticModulus>();
+		const double elasticModulus2 = neighbor.template getUnchecked<ElasticModulus>();
 		
-		const double normalDissipativeConstant1 = particle.template get<NormalDissipativeConstant>();
-		const double normalDissipativeConstant2 = neighbor.template get<NormalDissipativeConstant>();
+		const double normalDissipativeConstant1 = particle.template getUnchecked<NormalDissipativeConstant>();
+		const double normalDissipativeConstant2 = neighbor.template getUnchecked<NormalDissipativeConstant>();
 		
 		const auto effectiveElasticModulus = reciprocalOfSumOfReciprocals(elasticModulus1, elasticModulus2);
 		const auto effectiveNormalDissipativeConstant = reciprocalOfSumOfReciprocals(normalDissipativeConstant1, normalDissipativeConstant2);
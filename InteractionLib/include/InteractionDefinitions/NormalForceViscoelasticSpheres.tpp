@@ -28,18 +28,18 @@ Vector3D NormalForceViscoelasticSpheres::calculate(SphericalParticle<Ts...> & pa
 	if(overlap > 0)
 	{
 		// ---- Get physical properties and calculate effective parameters ----
-		const double radius1 = particle.template get<Radius>();
-		const double radius2 = neighbor.template get<Radius>();
+		const double radius1 = particle.template getUnchecked<Radius>();
+		const double radius2 = neighbor.template getUnchecked<Radius>();
 		const double effectiveRadius = radius1 * radius2 / ( radius1 + radius2 );
 		
-		const double elasticModulus1 = particle.template get<ElasticModulus>();
-		const double elasticModulus2 = neighbor.template get<ElasticModulus>();
+		const double elasticModulus1 = particle.template getUnchecked<ElasticModulus>();
+		const double elasticModulus2 = neighbor.template getUnchecked<ElasticModulus>();
 		
-		const double dissipativeConstant1 = particle.template get<DissipativeConstant>();
-		const double dissipativeConstant2 = neighbor.template get<DissipativeConstant>();
+		const double dissipativeConstant1 = particle.template getUnchecked<DissipativeConstant>();
+		const double dissipativeConstant2 = neighbor.template getUnchecked<DissipativeConstant>();
 		
-		const double poissonRatio1 = particle.template get<PoissonRatio>();
-		const double poissonRatio2 = neighbor.template get<PoissonRatio>();
+		const double poissonRatio1 = particle.template getUnchecked<PoissonRatio>();
+		const double poissonRatio2 = neighbor.template getUnchecked<PoissonRatio>();
 		
 		// ---- Calculate normal force ----
 		const double overlapDerivative = psin::overlapDerivative(particle, neighbor);
@@ -2,23 +2,22 @@
 #define TANGENTIAL_FORCE_CUNDALL_STRACK_HPP
 
 // EntityLib
-#include <HandledEntity.hpp>
 #include <SphericalParticle.hpp>
 
+// InteractionLib
+#include <ContactHistory.hpp>
+
 // UtilsLib
 #include <Builder.hpp>
 #include <NamedType.hpp>
 #include <string.hpp>
 #include <Vector3D.hpp>
 #include <mp/bool_constant.hpp>
+#include <mp/type_list.hpp>
 
 // JSONLib
 #include <json.hpp>
 
-// Standard
-#include <map>
-#include <utility>
-
 namespace psin {
 
 // ------------------ FORCE CALCULATION ------------------
@@ -30,6 +29,13 @@ namespace psin {
 struct TangentialForceCundallStrack
 {
 	public:
+		constexpr static bool is_contact_interaction = true;
+
+		// Cumulative tangential displacement since the contact started
+		using contact_history_type = Vector3D;
+
+		using properties = mp::type_list<TangentialKappa, FrictionParameter>;
+
 		template<typename P1, typename P2>
 		struct check : mp::bool_constant<
 			has_property<P1, TangentialKappa>::value
@@ -43,18 +49,7 @@ struct TangentialForceCundallStrack
 		{};
 
 		template<typename...Ts, typename...Us, typename Time>
-		static void calculate(SphericalParticle<Ts...> & particle, SphericalParticle<Us...> & neighbor, Time&& time);
-
-	private:
-		static std::map< std::pair<string, string>, Vector3D> cummulativeZeta;
-		static std::map< std::pair<string, string>, bool> collisionFlag;
-		
-		static void addZeta( const Named & particle, const Named & neighbor, const Vector3D & zeta );
-		static void setZeta( const Named & particle, const Named & neighbor, const Vector3D & zeta );
-
-		static void startCollision(const Named & particle, const Named & neighbor);
-		static bool checkCollision(const Named & particle, const Named & neighbor);
-		static void endCollision(const Named & particle, const Named & neighbor);
+		static void calculate(SphericalParticle<Ts...> & particle, SphericalParticle<Us...> & neighbor, Time&& time, ContactHistory<contact_history_type> & history);
 };
 
 template<typename I>
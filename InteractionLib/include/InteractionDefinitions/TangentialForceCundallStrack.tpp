@@ -12,8 +12,6 @@
 
 // Standard
 #include <algorithm>
-#include <map>
-#include <utility>
 
 namespace psin {
 
@@ -23,8 +21,9 @@ namespace psin {
 //		tangentialForce is the tangential force applied BY neighbor TO particle
 
 //		Calculates tangential forces between two spherical particles according to equation (2.21) (see reference)
+//		A contact's history is only touched while the particles touch each other, so it is dropped once the contact ends
 template<typename...Ts, typename...Us, typename Time>
-void TangentialForceCundallStrack::calculate(SphericalParticle<Ts...> & particle, SphericalParticle<Us...> & neighbor, Time&& time)
+void TangentialForceCundallStrack::calculate(SphericalParticle<Ts...> & particle, SphericalParticle<Us...> & neighbor, Time&& time, ContactHistory<contact_history_type> & history)
 {
 	// std::cout << "Calculating TangentialForceCundallStrack" << std::endl; // DEBUG
 
@@ -33,23 +32,20 @@ void TangentialForceCundallStrack::calculate(SphericalParticle<Ts...> & particle
 		const auto normalForce = particle.getNormalForce(neighbor);
 		const auto timeStep = time.getTimeStep();
 
-		if( !checkCollision(particle, neighbor) )
-		{
-			startCollision( particle, neighbor );
-			setZeta( particle, neighbor, nullVector3D() );
-		}
+		Vector3D & cummulativeZeta = history.touch(particle, neighbor); // null when the collision starts
+
 		// ---- Getting particles properties and parameters ----
 		const Vector3D position1 = particle.getPosition();
 		const Vector3D position2 = neighbor.getPosition();
-		const double tangentialKappa1 = particle.template get<TangentialKappa>();
-		const double tangentialKappa2 = neighbor.template get<TangentialKappa>();
+		const double tangentialKappa1 = particle.template getUnchecked<TangentialKappa>();
+		const double tangentialKappa2 = neighbor.template getUnchecked<TangentialKappa>();
 		const double effectiveTangentialKappa = 
 			tangentialKappa1 + tangentialKappa2 > 0
 			? reciprocalOfSumOfReciprocals(tangentialKappa1, tangentialKappa2)
 			: 0;
 			
-		const double frictionParameter1 = particle.template get<FrictionParameter>();
-		const double frictionParameter2 = neighbor.template get<FrictionParameter>();
+		const double frictionParameter1 = particle.template getUnchecked<FrictionParameter>();
+		const double frictionParameter2 = neighbor.template getUnchecked<FrictionParameter>();
 		const double effectiveFrictionParameter = std::min( frictionParameter1, frictionParameter2 );
 		
 		// Calculate tangential force
@@ -58,11 +54,9 @@ void TangentialForceCundallStrack::calculate(SphericalParticle<Ts...> & particle
 		const Vector3D relativeTangentialVelocity = particle.relativeTangentialVelocity( neighbor );
 		
 		const Vector3D tangentialVersor = particle.tangentialVersor( neighbor );
-		addZeta( particle, neighbor, relativeTangentialVelocity * timeStep );
+		cummulativeZeta += relativeTangentialVelocity * timeStep;
 		
-		const string name1 = std::min( particle.getName(), neighbor.getName() );
-		const string name2 = std::max( particle.getName(), neighbor.getName() );
-		const Vector3D tangentialForce = std::min( effectiveTangentialKappa * cummulativeZeta[ std::make_pair(name1, name2) ].length() , 
+		const Vector3D tangentialForce = std::min( effectiveTangentialKappa * cummulativeZeta.length() , 
 			effectiveFrictionParameter * normalForce.length() ) * tangentialVersor;
 		
 		particle.addContactForce( tangentialForce );
@@ -71,10 +65,6 @@ void TangentialForceCundallStrack::calculate(SphericalParticle<Ts...> & particle
 		particle.addTorque( cross(contactPoint - position1, tangentialForce) );
 		neighbor.addTorque( cross(contactPoint - position2, - tangentialForce) );
 	}// else, no forces and no torques are added.
-	else if( checkCollision(particle, neighbor) )
-	{
-		endCollision(particle, neighbor);
-	}
 }
 
 } // psin
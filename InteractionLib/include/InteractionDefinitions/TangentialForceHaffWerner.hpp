@@ -8,6 +8,7 @@
 #include <Builder.hpp>
 #include <NamedType.hpp>
 #include <mp/bool_constant.hpp>
+#include <mp/type_list.hpp>
 
 // JSONLib
 #include <json.hpp>
@@ -22,6 +23,10 @@ namespace psin {
 //		Calculates tangential forces between two spherical particles according to equation (2.18) (see reference)
 struct TangentialForceHaffWerner
 {
+	constexpr static bool is_contact_interaction = true;
+
+	using properties = mp::type_list<TangentialDamping, FrictionParameter>;
+
 	template<typename P1, typename P2>
 	struct check : mp::bool_constant<
 		has_property<P1, TangentialDamping>::value
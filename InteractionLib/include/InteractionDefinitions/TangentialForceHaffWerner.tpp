@@ -31,12 +31,12 @@ void TangentialForceHaffWerner::calculate(SphericalParticle<Ts...> & particle, S
 		// ---- Getting particles properties and parameters ----
 		const Vector3D position1 = particle.getPosition();
 		const Vector3D position2 = neighbor.getPosition();
-		const double tangentialDamping1 = particle.template get<TangentialDamping>();
-		const double tangentialDamping2 = neighbor.template get<TangentialDamping>();
+		const double tangentialDamping1 = particle.template getUnchecked<TangentialDamping>();
+		const double tangentialDamping2 = neighbor.template getUnchecked<TangentialDamping>();
 		const double effectiveTangentialDamping = std::min( tangentialDamping1 , tangentialDamping2 );
 			
-		const double frictionParameter1 = particle.template get<FrictionParameter>();
-		const double frictionParameter2 = neighbor.template get<FrictionParameter>();
+		const double frictionParameter1 = particle.template getUnchecked<FrictionParameter>();
+		const double frictionParameter2 = neighbor.template getUnchecked<FrictionParameter>();
 		const double effectiveFrictionParameter = std::min( frictionParameter1, frictionParameter2 );
 		
 		// ---- Calculate tangential force ----
@@ -144,12 +144,9 @@ std::vector<Vector3D> Interaction<>::taylorPredictor( const std::vector<Vector3D
 	return predictedVector;
 }
 
-std::vector<Vector3D> Interaction<>::gearCorrector(const std::vector<Vector3D> & predictedVector, const Vector3D & derivative, const int equationOrder, const int predictionOrder, const double dt)
+std::vector<double> Interaction<>::gearCorrectorConstants(const int equationOrder, const int predictionOrder)
 {
-	using std::vector;
-
-	vector<Vector3D> correctedVector = predictedVector;
-	vector<double> correctorConstants(predictionOrder + 1);
+	std::vector<double> correctorConstants(predictionOrder + 1);
 
 	switch(equationOrder)
 	{
@@ -202,7 +199,6 @@ std::vector<Vector3D> Interaction<>::gearCorrector(const std::vector<Vector3D> &
 					break;
 				default:
 					throw std::invalid_argument("There is no support for this prediction order. Prediction order must be either 2, 3, 4, 5, 6 or 7.");
-					return predictedVector;
 			}
 			break;
 		case 2:
@@ -249,14 +245,22 @@ std::vector<Vector3D> Interaction<>::gearCorrector(const std::vector<Vector3D> &
 					break;
 				default:
 					throw std::invalid_argument("There is no support for this prediction order. Prediction order must be either 3, 4, 5, 6 or 7.");
-					return predictedVector;
 			}
 			break;
 		default:
 			throw std::invalid_argument("There is no support for this equation order. Equation order must be either 1 or 2.");
-			return predictedVector;
 	}
 
+	return correctorConstants;
+}
+
+std::vector<Vector3D> Interaction<>::gearCorrector(const std::vector<Vector3D> & predictedVector, const Vector3D & derivative, const int equationOrder, const int predictionOrder, const double dt)
+{
+	using std::vector;
+
+	vector<Vector3D> correctedVector = predictedVector;
+	vector<double> correctorConstants = gearCorrectorConstants(equationOrder, predictionOrder);
+
 	for(auto i = 0 ; i <= predictionOrder ; ++i){
 		correctedVector[i] += (correctorConstants[i] * ( factorial(i) / pow(dt, i) ) * (pow(dt, equationOrder) / factorial(equationOrder)) ) * (derivative - predictedVector[equationOrder]);
 	}
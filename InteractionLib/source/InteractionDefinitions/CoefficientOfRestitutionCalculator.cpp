@@ -8,9 +8,6 @@
 
 namespace psin {
 	
-std::map<CoefficientOfRestitutionCalculator::name_pair, bool> CoefficientOfRestitutionCalculator::collisionFlag;
-std::map<CoefficientOfRestitutionCalculator::name_pair, double> CoefficientOfRestitutionCalculator::coefficientOfRestitution;
-std::map<CoefficientOfRestitutionCalculator::name_pair, CoefficientOfRestitutionCalculator::velocities_t> CoefficientOfRestitutionCalculator::velocities;
 unique_ptr<std::fstream> CoefficientOfRestitutionCalculator::file;
 bool CoefficientOfRestitutionCalculator::firstPrint = true;
 bool CoefficientOfRestitutionCalculator::initialized = false;
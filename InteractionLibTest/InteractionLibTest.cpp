@@ -11,11 +11,13 @@
 #include <PropertyDefinitions.hpp>
 
 //EntityLib
+#include <FixedOrderSpatialEntity.hpp>
 #include <Particle.hpp>
 #include <PhysicalEntity.hpp>
 #include <SphericalParticle.hpp>
 
 //InteractionLib
+#include <ContactHistory.hpp>
 #include <Interaction.hpp>
 #include <InteractionDefinitions.hpp>
 
@@ -25,6 +27,17 @@
 using namespace psin;
 using namespace std;
 
+// Stands in for the simulation's time, which the interactions receive in calculate
+struct TestTime
+{
+	double timeStep;
+
+	double getTimeStep() const
+	{
+		return timeStep;
+	}
+};
+
 
 TestCase( TaylorPredictor_Test )
 {
@@ -63,6 +76,77 @@ TestCase( TaylorPredictor_Test )
 		}
 }
 
+TestCase( FixedOrderPredictorCorrector_Test )
+{
+	constexpr std::size_t predictionOrder = 4;
+	const double dt = 1e-3;
+
+	FixedOrderSpatialEntity<predictionOrder> spatial;
+	spatial.setPosition( Vector3D(1.0, 4.0, -1.0) );
+	spatial.setVelocity( Vector3D(3.0, -5.0, 2.0) );
+	spatial.setAcceleration( Vector3D(15.0, 8.0, -5.0) );
+	spatial.setPositionDerivative( 3, Vector3D(-2.0, 1.0, 0.5) );
+
+	const vector<Vector3D> currentVector = spatial.toSpatialEntity().getPositionMatrix();
+
+	vector<Vector3D> predictedVector = Interaction<>::taylorPredictor( currentVector, predictionOrder, dt );
+	Interaction<>::taylorPredict<predictionOrder>( spatial.positionMatrix(), Interaction<>::taylorCoefficients<predictionOrder>(dt) );
+
+	for(std::size_t i = 0 ; i <= predictionOrder ; ++i)
+	{
+		check( spatial.getPositionDerivative(i) == predictedVector[i] );
+	}
+
+	const Vector3D acceleration(14.0, 9.0, -4.0);
+	vector<Vector3D> correctedVector = Interaction<>::gearCorrector( predictedVector, acceleration, 2, predictionOrder, dt );
+	Interaction<>::gearCorrect<2, predictionOrder>( spatial.positionMatrix(), acceleration, Interaction<>::gearCorrectorFactors<2, predictionOrder>(dt) );
+
+	for(std::size_t i = 0 ; i <= predictionOrder ; ++i)
+	{
+		check( spatial.getPositionDerivative(i) == correctedVector[i] );
+	}
+
+	std::size_t dispatchedOrder = 0;
+	dispatchTaylorOrder( 5, [&](auto TaylorOrder){ dispatchedOrder = FixedOrderSpatialEntity<TaylorOrder>().getTaylorOrder(); } );
+	checkEqual( dispatchedOrder, 5u );
+}
+
+TestCase( ContactHistory_Test )
+{
+	ContactHistory<Vector3D> history;
+	HandledEntity entity1(1), entity2(2), entity3(3);
+
+	check( history.find(entity1, entity2) == nullptr );
+
+	history.touch(entity2, entity1) += Vector3D(1.0, 0.0, 0.0);
+	history.touch(entity1, entity2) += Vector3D(1.0, 0.0, 0.0);
+	history.touch(entity1, entity3);
+	checkEqual( history.size(), 2u );
+	check( *history.find(entity1, entity2) == Vector3D(2.0, 0.0, 0.0) );
+
+	// Only contacts touched since the last step survive
+	history.age();
+	history.touch(entity1, entity2);
+	history.age();
+	checkEqual( history.size(), 1u );
+	check( history.find(entity1, entity3) == nullptr );
+	check( *history.find(entity1, entity2) == Vector3D(2.0, 0.0, 0.0) );
+
+	// Growing keeps every entry, and aging shrinks the table back
+	for(int handle = 10; handle < 1010; ++handle)
+	{
+		history.touch( makeHandlePair(entity1, HandledEntity(handle)) ) = Vector3D(handle, 0.0, 0.0);
+	}
+	checkEqual( history.size(), 1001u );
+	check( *history.find(entity1, entity2) == Vector3D(2.0, 0.0, 0.0) );
+	check( *history.find(HandledEntity(500), entity1) == Vector3D(500.0, 0.0, 0.0) );
+
+	history.age();
+	history.age();
+	checkEqual( history.size(), 0u );
+	checkEqual( history.capacity(), 16u );
+}
+
 TestCase(RequireProperties_Test)
 {
 	// check((
@@ -112,7 +196,7 @@ TestCase(ElectrostaticForce_Test)
 		ElectrostaticForce::check< Particle<>, Particle<ElectricCharge, Volume> >::value
 	));
 
-	ElectrostaticForce::calculate(p1, p2);
+	ElectrostaticForce::calculate(p1, p2, TestTime{0.5});
 
 	check(p1.getResultingForce() == ResultingForceOnP1);
 	check(p2.getResultingForce() == ResultingForceOnP2);
@@ -165,7 +249,7 @@ TestCase(NormalForceLinearDashpotForce_Test)
 			>::value
 	));
 
-	NormalForceLinearDashpotForce::calculate(p1, p2);
+	NormalForceLinearDashpotForce::calculate(p1, p2, TestTime{0.5});
 
 	//TODO check values
 }
@@ -222,7 +306,7 @@ TestCase(NormalForceViscoelasticSpheres_Test)
 			>::value
 	));
 
-	NormalForceViscoelasticSpheres::calculate(p1, p2);
+	NormalForceViscoelasticSpheres::calculate(p1, p2, TestTime{0.5});
 
 	//TODO check values
 }
@@ -270,6 +354,10 @@ TestCase(TangentialForceCundallStrack_Test)
 
 	Vector3D normalForce(500, 0, 0);
 	double timeStep = 0.5;
+	ContactHistory<TangentialForceCundallStrack::contact_history_type> history;
+
+	p1.setNormalForce(p2, normalForce);
+	p2.setNormalForce(p1, - normalForce);
 
 	check((
 		TangentialForceCundallStrack::check< SphericalParticle<TangentialKappa, FrictionParameter, PoissonRatio>, 
@@ -282,7 +370,7 @@ TestCase(TangentialForceCundallStrack_Test)
 			>::value
 	));
 
-	TangentialForceCundallStrack::calculate(p1, p2, normalForce, timeStep);
+	TangentialForceCundallStrack::calculate(p1, p2, TestTime{timeStep}, history);
 
 	//TODO check values
 }
@@ -330,6 +418,10 @@ TestCase(TangentialForceHaffWerner_Test)
 
 	Vector3D normalForce(500, 0, 0);
 	double timeStep = 0.5;
+
+	p1.setNormalForce(p2, normalForce);
+	p2.setNormalForce(p1, - normalForce);
+
 	check((
 		TangentialForceHaffWerner::check< SphericalParticle<TangentialDamping, FrictionParameter, PoissonRatio>, 
 			SphericalParticle<TangentialKappa, ElasticModulus, TangentialDamping, Volume, PoissonRatio, FrictionParameter> 
@@ -341,7 +433,7 @@ TestCase(TangentialForceHaffWerner_Test)
 			>::value
 	));
 
-	TangentialForceHaffWerner::calculate(p1, p2, normalForce, timeStep);
+	TangentialForceHaffWerner::calculate(p1, p2, TestTime{timeStep});
 
 	//TODO check values
 }
@@ -361,7 +453,7 @@ TestCase(GravityForce_Test)
 	gravityField.set<Gravity>(gravity);
 	particle.set<Mass>(mass);
 
-	GravityForce::calculate(particle, gravityField);
+	GravityForce::calculate(particle, gravityField, TestTime{0.5});
 	checkEqual(particle.getResultingForce(), mass*gravity);
 }
 
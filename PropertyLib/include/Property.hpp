@@ -1,11 +1,9 @@
 #ifndef PROPERTY_HPP
 #define PROPERTY_HPP
 
-// UtilsLib
-#include <UniquePointer.hpp>
-
 namespace psin {
 
+// The value is stored inline, so properties do not allocate and are copied as plain members
 template<typename T = double>
 class Property
 {
@@ -22,7 +20,11 @@ class Property
 		template<typename U>
 		void set(const U & value);
 
-		virtual T get() const;
+		virtual T get() const; // throws
+
+		// Fast accessor for hot paths: does not check whether the property was assigned.
+		// A property which was never assigned holds a value-initialized T.
+		const T & getUnchecked() const;
 
 		// Assigned
 		bool assigned() const;
@@ -30,7 +32,7 @@ class Property
 		virtual ~Property() = default;
 
 	protected:
-		unique_ptr<T> value;
+		T value = T();
 
 		void assign(const T & value);
 		bool assignedFlag = false;
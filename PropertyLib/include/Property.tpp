@@ -6,10 +6,7 @@ namespace psin {
 template<typename T>
 Property<T>& Property<T>::operator=(const Property<T> & other)
 {
-	if(other.value)
-	{
-		this->value = make_unique<T>( *other.value );
-	}
+	this->value = other.value;
 	this->assignedFlag = other.assignedFlag;
 
 	return *this;
@@ -24,13 +21,9 @@ Property<T>::Property(const T & value)
 
 template<typename T>
 Property<T>::Property(const Property<T> & other)
-	: assignedFlag(other.assignedFlag)
-{
-	if(other.value)
-	{
-		this->value = make_unique<T>( *other.value );
-	}
-}
+	: value(other.value),
+	assignedFlag(other.assignedFlag)
+{}
 
 
 // ----- Set and get value -----
@@ -46,7 +39,7 @@ T Property<T>::get() const
 {
 	if(assigned())
 	{
-		return *this->value;
+		return this->value;
 	}
 	else
 	{
@@ -54,10 +47,16 @@ T Property<T>::get() const
 	}
 }
 
+template<typename T>
+const T & Property<T>::getUnchecked() const
+{
+	return this->value;
+}
+
 template<typename T>
 void Property<T>::assign(const T & value)
 {
-	this->value = make_unique<T>(value);
+	this->value = value;
 	this->assignedFlag = true;
 }
 
@@ -34,6 +34,11 @@ private:
 void from_json(const json & j, Color & c);
 void to_json(json & j, const Color & c);
 
+// RGB components, between 0 and 1, of a color's value. Besides its RGB components, a color may be
+// given by one of matplotlib's basic color names, such as "Red" or "r", whatever their case.
+// Other names give gray.
+Vector3D rgbOf(const Color::ValueType & color);
+
 } // psin
 
 #endif // COLOR_HPP
@@ -14,6 +14,10 @@
 // PropertyLib
 #include <Property.hpp>
 
+// Standard
+#include <cctype>
+#include <map>
+
 namespace psin {
 
 Color::Color()
@@ -66,6 +70,33 @@ void to_json(json & j, const Color & c)
 	j = c.as_json();
 }
 
+Vector3D rgbOf(const Color::ValueType & color)
+{
+	static const std::map<string, Vector3D> namedColors{
+		{"blue", Vector3D(0.0, 0.0, 1.0)},		{"b", Vector3D(0.0, 0.0, 1.0)},
+		{"green", Vector3D(0.0, 0.5, 0.0)},		{"g", Vector3D(0.0, 0.5, 0.0)},
+		{"red", Vector3D(1.0, 0.0, 0.0)},		{"r", Vector3D(1.0, 0.0, 0.0)},
+		{"cyan", Vector3D(0.0, 0.75, 0.75)},	{"c", Vector3D(0.0, 0.75, 0.75)},
+		{"magenta", Vector3D(0.75, 0.0, 0.75)},	{"m", Vector3D(0.75, 0.0, 0.75)},
+		{"yellow", Vector3D(0.75, 0.75, 0.0)},	{"y", Vector3D(0.75, 0.75, 0.0)},
+		{"black", Vector3D(0.0, 0.0, 0.0)},		{"k", Vector3D(0.0, 0.0, 0.0)},
+		{"white", Vector3D(1.0, 1.0, 1.0)},		{"w", Vector3D(1.0, 1.0, 1.0)},
+		{"gray", Vector3D(0.5, 0.5, 0.5)},		{"grey", Vector3D(0.5, 0.5, 0.5)},
+		{"orange", Vector3D(1.0, 0.65, 0.0)},
+		{"purple", Vector3D(0.5, 0.0, 0.5)},
+		{"brown", Vector3D(0.65, 0.16, 0.16)},
+		{"pink", Vector3D(1.0, 0.75, 0.8)}
+	};
+
+	if(color.second.empty()) return color.first;
+
+	string name = color.second;
+	for(char & c : name) c = std::tolower(static_cast<unsigned char>(c));
+
+	const auto namedColor = namedColors.find(name);
+	return namedColor != namedColors.end() ? namedColor->second : Vector3D(0.5, 0.5, 0.5);
+}
+
 } // psin
 
 
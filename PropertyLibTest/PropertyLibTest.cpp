@@ -49,28 +49,18 @@ TestCase(PropertyConstructorsTest)
 	// property3.input(std::cin);
 }
 
-TestCase(PropertyInputAndOutputTest)
+TestCase(Property_Copy_Test)
 {
-	double tolerance = 1e-12;
-	double value = 3.14;
-
-	string fileName = "Property_Input_Output_Test.txt";
-	fstream file(fileName, fstream::in | fstream::out | fstream::trunc);
-
-	Property<double> property1(value);
-	property1.output(file);
-
-	file.clear();
-	file.seekg(0, ios::beg);
+	Property<double> property1(3.14);
+	Property<double> property2 = property1;
 
-	Property<double> property2;
-	property2.input(file);
+	property2.set(2.72);
+	checkEqual(property1.get(), 3.14);
+	checkEqual(property2.getUnchecked(), 2.72);
 
-	check(property2.assigned());
-	checkClose(property2.get(), value, tolerance);
-
-	if( remove(fileName.c_str()) != 0 )
-    	throw std::runtime_error("Error deleting \"Property_Input_Output_Test.txt\"");
+	property1 = Property<double>();
+	check(!property1.assigned());
+	checkEqual(property1.getUnchecked(), 0.0);
 }
 
 TestCase(Property_ValueType_Test)
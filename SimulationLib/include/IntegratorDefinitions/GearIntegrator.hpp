@@ -1,6 +1,9 @@
 #ifndef GEAR_INTEGRATOR_HPP
 #define GEAR_INTEGRATOR_HPP
 
+// EntityLib
+#include <FixedOrderSpatialEntity.hpp>
+
 // JSONLib
 #include <json.hpp>
 
@@ -8,12 +11,75 @@
 #include <string.hpp>
 
 // Standard
+#include <array>
+#include <cstddef>
 #include <utility>
 
 namespace psin {
-	
+
 struct GearIntegrator
 {
+	constexpr static std::size_t maxEquationOrder = 2;
+	constexpr static std::size_t maxPredictionOrder = MAX_FIXED_TAYLOR_ORDER;
+
+	using CoefficientRow = std::array<double, maxPredictionOrder + 1>;
+	using CorrectorTable = std::array<std::array<CoefficientRow, maxPredictionOrder + 1>, maxEquationOrder + 1>;
+
+	// factorials[k] == k!
+	constexpr static CoefficientRow factorials = {{1., 1., 2., 6., 24., 120., 720., 5040.}};
+
+	// Gear's corrector constants, indexed by [equationOrder][predictionOrder][derivative].
+	// Rows filled with zeros correspond to unsupported combinations.
+	constexpr static CorrectorTable correctorConstants = {{
+		{{}},
+		{{
+			{}, {},
+			{{5./12., 1., 1./2.}},
+			{{3./8., 1., 3./4., 1./6.}},
+			{{251./720., 1., 11./12., 1./3., 1./24.}},
+			{{95./288., 1., 25./24., 35./72., 5./48., 1./120.}},
+			{{19087./60480., 1., 137./120., 5./8., 17./96., 1./40., 1./720.}},
+			{{5257./17280., 1., 49./40., 203./270., 49./192., 7./144., 7./1440., 1./5040.}}
+		}},
+		{{
+			{}, {}, {},
+			{{1./6., 5./6., 1., 1./3.}},
+			{{19./120., 3./4., 1., 1./2., 1./12.}},
+			{{3./20., 251./360., 1., 11./18., 1./6., 1./60.}},
+			{{863./6048., 665./1008., 1., 25./36., 35./144., 1./24., 1./360.}},
+			{{1925./14112., 19087./30240., 1., 137./180., 5./16., 17./240., 1./120., 1./2520.}}
+		}}
+	}};
+
+	static_assert(maxPredictionOrder == 7, "Gear's tables must be extended along with MAX_FIXED_TAYLOR_ORDER");
+
+	constexpr static bool hasCorrector(const std::size_t equationOrder, const std::size_t predictionOrder)
+	{
+		return equationOrder <= maxEquationOrder
+			and predictionOrder <= maxPredictionOrder
+			and correctorConstants[equationOrder][predictionOrder][0] != 0.0;
+	}
+
+	// Coefficients holds the time step scaling of the tables above, so that
+	// predicting and correcting a state only costs multiply-adds:
+	// 	predictor()[k] == dt^k / k!
+	// 	corrector(equationOrder, predictionOrder)[k] == correctorConstants[equationOrder][predictionOrder][k] * (k! / dt^k) * (dt^equationOrder / equationOrder!)
+	class Coefficients
+	{
+	public:
+		explicit Coefficients(const double timeStep);
+
+		double getTimeStep() const;
+
+		const CoefficientRow & predictor() const;
+		const CoefficientRow & corrector(const std::size_t equationOrder, const std::size_t predictionOrder) const;
+
+	private:
+		double timeStep;
+		CoefficientRow predictorCoefficients;
+		CorrectorTable correctorCoefficients;
+	};
+
 	template<typename Index, typename Value>
 	class Time
 	{
@@ -25,11 +91,14 @@ struct GearIntegrator
 		Time(const value_type & initialInstant, const value_type & timeStep, const value_type & finalInstant);
 
 		void start();
+		// Continues from a time index and instant saved from another run, such as a checkpoint's
+		void resume(const index_type & timeIndex, const value_type & time);
 		void update();
 		bool end() const;
 
 		index_type getIndex() const;
 		value_type getTimeStep() const;
+		const Coefficients & getCoefficients() const;
 
 		string getIndexTag() const;
 		string getTimeTag() const;
@@ -44,6 +113,8 @@ struct GearIntegrator
 		value_type initialInstant;
 		value_type timeStep;
 		value_type finalInstant;
+
+		Coefficients coefficients;
 	};
 };
 
@@ -11,7 +11,8 @@ GearIntegrator::Time<Index, Value>::Time(const Value & initialInstant, const Val
 	time(initialInstant),
 	initialInstant(initialInstant),
 	timeStep(timeStep),
-	finalInstant(finalInstant)
+	finalInstant(finalInstant),
+	coefficients(timeStep)
 {}
 
 template<typename Index, typename Value>
@@ -21,6 +22,13 @@ void GearIntegrator::Time<Index, Value>::start()
 	this->timeIndex = index_type(0);
 }
 
+template<typename Index, typename Value>
+void GearIntegrator::Time<Index, Value>::resume(const Index & timeIndex, const Value & time)
+{
+	this->time = time;
+	this->timeIndex = timeIndex;
+}
+
 template<typename Index, typename Value>
 void GearIntegrator::Time<Index, Value>::update()
 {
@@ -48,6 +56,13 @@ auto GearIntegrator::Time<Index, Value>::getTimeStep() const
 	return this->timeStep;
 }
 
+template<typename Index, typename Value>
+auto GearIntegrator::Time<Index, Value>::getCoefficients() const
+	-> const Coefficients &
+{
+	return this->coefficients;
+}
+
 template<typename Index, typename Value>
 string GearIntegrator::Time<Index, Value>::getIndexTag() const
 {
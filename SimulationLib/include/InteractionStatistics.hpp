@@ -0,0 +1,99 @@
+#ifndef INTERACTION_STATISTICS_HPP
+#define INTERACTION_STATISTICS_HPP
+
+// UtilsLib
+#include <string.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace psin {
+
+// Force evaluations are not counted apart: contact interactions apply a force to the touching pairs
+// only, and the other interactions to every candidate
+struct InteractionCounters
+{
+	unsigned long candidatePairs = 0;	// pairs handed to the interaction
+	unsigned long touchingPairs = 0;	// candidates whose overlap is positive
+	unsigned long contactsStarted = 0;	// touching pairs that did not touch in the step before
+	unsigned long contactsEnded = 0;	// pairs that stopped touching
+
+	InteractionCounters & operator+=(const InteractionCounters & other);
+};
+
+void to_json(json & j, const InteractionCounters & counters);
+
+// InteractionStatistics counts what the interactions of each triplet do in every time step, and
+// the number of contacts each particle has (its coordination number).
+//
+// Each thread counts into its own tally, given by the thread index PairEvaluator passes along, so
+// that counting neither takes locks nor shares cache lines between threads. Tallies are folded
+// together once per step, by endStep().
+class InteractionStatistics
+{
+	public:
+		// Indices of an entity and of its neighbor in their vectors
+		using index_pair = std::pair<std::size_t, std::size_t>;
+
+		class Triplet
+		{
+			public:
+				// Every candidate pair is counted once, from the thread with the given index
+				void countCandidate(const unsigned thread);
+				// Counts a candidate that touches
+				void countTouching(const unsigned thread, const index_pair & pair);
+
+			private:
+				friend class InteractionStatistics;
+
+				// Aligned so that two threads never write to the same cache line
+				struct alignas(64) Tally
+				{
+					InteractionCounters counters;
+					std::vector<index_pair> touching;
+				};
+
+				string interaction;
+				string entityType;
+				string neighborType;
+				bool neighborIsParticle;
+
+				std::vector<Tally> tallies;
+				std::vector<index_pair> contacts;	// sorted pairs touching in the last step
+				std::vector<index_pair> previousContacts;
+				InteractionCounters counters;		// since the last call to collect()
+		};
+
+		// Tallies for threads [0, numberOfThreads) are kept
+		void setNumberOfThreads(const unsigned numberOfThreads);
+
+		// Particles of the given type are indexed from 0 to numberOfParticles - 1
+		void setNumberOfParticles(const string & particleType, const std::size_t numberOfParticles);
+
+		// The triplet's tally, added the first time it is asked for
+		Triplet & triplet(const string & interaction, const string & entityType, const string & neighborType, const bool neighborIsParticle);
+
+		// Folds the threads' tallies and compares each triplet's contacts to the step before
+		void endStep();
+
+		// Counters since the last call, per triplet, and the histogram of coordination numbers in the
+		// last step: "CoordinationNumbers"[n] is the number of particles with n contacts
+		json collect();
+
+	private:
+		unsigned numberOfThreads = 1;
+		std::vector< std::unique_ptr<Triplet> > triplets;
+		std::map<string, std::size_t> numberOfParticles;
+		unsigned long steps = 0;
+};
+
+} // psin
+
+#endif // INTERACTION_STATISTICS_HPP
@@ -0,0 +1,102 @@
+#ifndef OUTPUT_FIELD_HPP
+#define OUTPUT_FIELD_HPP
+
+// IOLib
+#include <TrajectoryFormat.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// UtilsLib
+#include <string.hpp>
+#include <Vector3D.hpp>
+
+// Standard
+#include <cstddef>
+#include <vector>
+
+namespace psin {
+
+// OutputField selects a particle quantity stored in every output frame. main.json lists them
+// under "OutputFields", each one being either a field name or an object such as
+//
+// 	{"Name": "PositionMatrix", "TaylorOrders": [0, 1], "Precision": 6, "Type": "float32", "Tolerance": 1e-9}
+//
+// where every entry but "Name" is optional:
+// 	TaylorOrders: rows of PositionMatrix or OrientationMatrix to store, all of them by default;
+// 	Precision: significant digits kept in each value, all of them by default;
+// 	Type: "float64" or "float32", how binary trajectories store the field. JSON output writes
+// 		float32 fields with the digits a float holds;
+// 	Tolerance: largest error allowed when the "Compressed" output format quantizes the field's
+// 		values, which are stored exactly by default.
+//
+// Field names are the keys of the particles' JSON output.
+class OutputField
+{
+	public:
+		enum class Quantity
+		{
+			Position, Velocity, Acceleration,
+			Orientation, AngularVelocity, AngularAcceleration,
+			PositionMatrix, OrientationMatrix,
+			BodyForce, ContactForce, ResultingForce, ResultingTorque,
+			LinearMomentum, AngularMomentum,
+			KineticEnergy, TranslationalEnergy, RotationalEnergy
+		};
+
+		OutputField() = default;
+		explicit OutputField(const string & name); // throws
+
+		const string & getName() const;
+		Quantity getQuantity() const;
+
+		void setTaylorOrders(const std::vector<std::size_t> & taylorOrders); // throws
+		const std::vector<std::size_t> & getTaylorOrders() const;
+
+		void setPrecision(const int precision); // throws
+		int getPrecision() const;
+
+		void setType(const string & type); // throws
+		const string & getType() const;
+
+		void setTolerance(const double tolerance); // throws
+		double getTolerance() const;
+
+		bool isMatrix() const;
+		bool isScalar() const;
+
+		// Number of values the field takes for a particle with the given Taylor order.
+		// Throws if the field asks for a derivative the particle does not have.
+		std::size_t getComponents(const std::size_t taylorOrder) const; // throws
+
+		// Rows of the field's Taylor matrix stored for a particle with the given Taylor order
+		std::vector<std::size_t> getRows(const std::size_t taylorOrder) const; // throws
+
+		// value with the digits that this field keeps
+		double round(const double value) const;
+
+	private:
+		string name;
+		Quantity quantity = Quantity::Position;
+		std::vector<std::size_t> taylorOrders;
+		int precision = 0;
+		string type = trajectory::float64Type;
+		double tolerance = 0.0;
+};
+
+void to_json(json & j, const OutputField & field);
+void from_json(const json & j, OutputField & field); // throws
+
+// Appends field's values for particle to values, rounded to the field's precision
+template<typename P>
+void append_output_field(const OutputField & field, const P & particle, std::vector<double> & values);
+
+// field's value for particle as it is written to JSON output
+template<typename P>
+json output_field_json(const OutputField & field, const P & particle);
+
+} // psin
+
+#include <OutputField.tpp>
+
+#endif // OUTPUT_FIELD_HPP
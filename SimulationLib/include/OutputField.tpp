@@ -0,0 +1,68 @@
+#ifndef OUTPUT_FIELD_TPP
+#define OUTPUT_FIELD_TPP
+
+namespace psin {
+
+template<typename P>
+void append_output_field(const OutputField & field, const P & particle, std::vector<double> & values)
+{
+	auto appendVector = [&](const Vector3D & vector)
+	{
+		values.push_back( field.round(vector.x()) );
+		values.push_back( field.round(vector.y()) );
+		values.push_back( field.round(vector.z()) );
+	};
+
+	using Quantity = OutputField::Quantity;
+	switch(field.getQuantity())
+	{
+		case Quantity::Position: appendVector(particle.getPosition()); break;
+		case Quantity::Velocity: appendVector(particle.getVelocity()); break;
+		case Quantity::Acceleration: appendVector(particle.getAcceleration()); break;
+		case Quantity::Orientation: appendVector(particle.getOrientation()); break;
+		case Quantity::AngularVelocity: appendVector(particle.getAngularVelocity()); break;
+		case Quantity::AngularAcceleration: appendVector(particle.getAngularAcceleration()); break;
+		case Quantity::PositionMatrix:
+		{
+			const std::vector<Vector3D> matrix = particle.getPositionMatrix();
+			for(const std::size_t row : field.getRows(particle.getTaylorOrder())) appendVector(matrix[row]);
+			break;
+		}
+		case Quantity::OrientationMatrix:
+		{
+			const std::vector<Vector3D> matrix = particle.getOrientationMatrix();
+			for(const std::size_t row : field.getRows(particle.getTaylorOrder())) appendVector(matrix[row]);
+			break;
+		}
+		case Quantity::BodyForce: appendVector(particle.getBodyForce()); break;
+		case Quantity::ContactForce: appendVector(particle.getContactForce()); break;
+		case Quantity::ResultingForce: appendVector(particle.getResultingForce()); break;
+		case Quantity::ResultingTorque: appendVector(particle.getResultingTorque()); break;
+		case Quantity::LinearMomentum: appendVector(particle.getLinearMomentum()); break;
+		case Quantity::AngularMomentum: appendVector(particle.getAngularMomentum()); break;
+		case Quantity::KineticEnergy: values.push_back( field.round(particle.getKineticEnergy()) ); break;
+		case Quantity::TranslationalEnergy: values.push_back( field.round(particle.getTranslationalEnergy()) ); break;
+		case Quantity::RotationalEnergy: values.push_back( field.round(particle.getRotationalEnergy()) ); break;
+	}
+}
+
+template<typename P>
+json output_field_json(const OutputField & field, const P & particle)
+{
+	std::vector<double> values;
+	append_output_field(field, particle, values);
+
+	if(field.isScalar()) return values.front();
+
+	// Vectors are written as [x, y, z], and matrices as lists of rows
+	json rows = json::array();
+	for(std::size_t i = 0; i < values.size(); i += 3)
+	{
+		rows.push_back( json{values[i], values[i + 1], values[i + 2]} );
+	}
+	return field.isMatrix() ? rows : rows.front();
+}
+
+} // psin
+
+#endif // OUTPUT_FIELD_TPP
@@ -0,0 +1,73 @@
+#ifndef PAIR_EVALUATOR_HPP
+#define PAIR_EVALUATOR_HPP
+
+// EntityLib
+#include <DynamicsRecorder.hpp>
+
+// SimulationLib
+#include <ParticleStore.hpp>
+
+// UtilsLib
+#include <ThreadPool.hpp>
+
+// Standard
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace psin {
+
+// PairEvaluator evaluates the interactions of many pairs of entities on a thread pool.
+//
+// The pairs are split into one contiguous block per thread, and each thread records the
+// forces, torques and normal forces its pairs produce in its own DynamicsRecorder. The
+// records are then applied block after block, so every force is summed in the same order as
+// in a serial run, and the result is bit-identical to it regardless of the number of threads.
+//
+// When the reduction is not deterministic, the forces on tracked ParticleStores are summed per
+// thread and the partial sums are added in parallel. This is faster, but the result is then
+// rounded differently than in a serial run and depends on the number of threads.
+class PairEvaluator
+{
+	public:
+		using index_pair = std::pair<std::size_t, std::size_t>;
+
+		explicit PairEvaluator(ThreadPool & threadPool);
+
+		void setDeterministic(const bool deterministic);
+		bool isDeterministic() const;
+
+		// Whether evaluate() would run every pair on the calling thread
+		bool isSerial() const;
+
+		// Registers the force columns of store for non-deterministic reduction
+		template<typename ParticleType>
+		void track(ParticleStore<ParticleType> & store);
+		void clearTracked();
+
+		// A buffer for the pairs' indices, which callers may fill before calling evaluate
+		std::vector<index_pair> & pairs();
+
+		// Calls evaluatePair(i) for every i in [0, numberOfPairs) and applies the recorded results.
+		// evaluatePair may also take the index of the thread it runs on, as evaluatePair(i, threadIndex).
+		template<typename Function>
+		void evaluate(const std::size_t numberOfPairs, Function && evaluatePair);
+
+	private:
+		void prepareRecorders();
+		void reduce();
+
+		ThreadPool & threadPool;
+		bool deterministic = true;
+
+		std::vector< std::pair<Vector3D *, std::size_t> > trackedColumns;
+		std::vector<DynamicsRecorder> recorders;
+		std::vector<index_pair> pairBuffer;
+};
+
+} // psin
+
+#include <PairEvaluator.tpp>
+
+#endif // PAIR_EVALUATOR_HPP
@@ -0,0 +1,65 @@
+#ifndef PAIR_EVALUATOR_TPP
+#define PAIR_EVALUATOR_TPP
+
+namespace psin {
+
+template<typename ParticleType>
+void PairEvaluator::track(ParticleStore<ParticleType> & store)
+{
+	this->trackedColumns.emplace_back(store.bodyForceColumn(), store.size());
+	this->trackedColumns.emplace_back(store.contactForceColumn(), store.size());
+	this->trackedColumns.emplace_back(store.torqueColumn(), store.size());
+
+	this->recorders.clear();
+}
+
+namespace detail {
+
+template<typename Function>
+void evaluate_pair(Function & evaluatePair, const std::size_t pair, const unsigned threadIndex)
+{
+	if constexpr(std::is_invocable<Function &, std::size_t, unsigned>::value)
+	{
+		evaluatePair(pair, threadIndex);
+	}
+	else
+	{
+		evaluatePair(pair);
+	}
+}
+
+} // detail
+
+template<typename Function>
+void PairEvaluator::evaluate(const std::size_t numberOfPairs, Function && evaluatePair)
+{
+	if(this->isSerial())
+	{
+		for(std::size_t pair = 0; pair < numberOfPairs; ++pair)
+		{
+			detail::evaluate_pair(evaluatePair, pair, 0);
+		}
+		return;
+	}
+
+	this->prepareRecorders();
+
+	const std::size_t numberOfThreads = this->recorders.size();
+	this->threadPool.run([&, this](const unsigned threadIndex)
+	{
+		DynamicsRecorder::Scope scope(this->recorders[threadIndex]);
+
+		const std::size_t begin = numberOfPairs * threadIndex / numberOfThreads;
+		const std::size_t end = numberOfPairs * (threadIndex + 1) / numberOfThreads;
+		for(std::size_t pair = begin; pair < end; ++pair)
+		{
+			detail::evaluate_pair(evaluatePair, pair, threadIndex);
+		}
+	});
+
+	this->reduce();
+}
+
+} // psin
+
+#endif // PAIR_EVALUATOR_TPP
@@ -0,0 +1,95 @@
+#ifndef PARTICLE_STORE_HPP
+#define PARTICLE_STORE_HPP
+
+// EntityLib
+#include <SphericalParticle.hpp>
+
+// SimulationLib
+#include <IntegratorDefinitions/GearIntegrator.hpp>
+
+// UtilsLib
+#include <Vector3D.hpp>
+
+// Standard
+#include <cstddef>
+#include <vector>
+
+namespace psin {
+
+// ParticleStore keeps the state the integrator touches every time step in
+// structure-of-arrays form: one contiguous array per position and orientation
+// derivative, plus arrays for forces, torques, masses, moments of inertia and radii.
+// Once bound, each particle reads and writes its kinematics and dynamics from the
+// store, so that the particle's API works as a view over the store's columns.
+//
+// The n-th derivative of the position of particle i is position(n)[i].
+template<typename ParticleType>
+class ParticleStore
+{
+	public:
+		// Moves the particles' state into the store. particles must not be resized afterwards.
+		// Throws if Gear's corrector does not support some particle's Taylor order.
+		void bind(std::vector<ParticleType> & particles); // throws
+		void unbind(std::vector<ParticleType> & particles);
+
+		std::size_t size() const;
+		std::size_t getTaylorOrder() const;
+
+		Vector3D * position(const std::size_t derivative);
+		Vector3D * orientation(const std::size_t derivative);
+
+		const std::vector<double> & getRadii() const;
+
+		Vector3D * bodyForceColumn();
+		Vector3D * contactForceColumn();
+		Vector3D * torqueColumn();
+
+		void resetForces();
+		void resetForces(const std::size_t begin, const std::size_t end);
+
+		// Taylor predictor applied to every particle, in place
+		void predict(const GearIntegrator::Coefficients & coefficients);
+		void predict(const GearIntegrator::Coefficients & coefficients, const std::size_t begin, const std::size_t end);
+
+		// Gear corrector applied to every particle, in place
+		void correct(const GearIntegrator::Coefficients & coefficients);
+		void correct(const GearIntegrator::Coefficients & coefficients, const std::size_t begin, const std::size_t end);
+
+		// The overloads taking [begin, end) only touch particles in that range, so disjoint
+		// ranges may be processed by different threads at the same time.
+
+	private:
+		constexpr static bool spherical = is_spherical<ParticleType>::value;
+		constexpr static std::size_t orientationEquationOrder = spherical ? 1 : 2;
+		constexpr static std::size_t orientationOffset = spherical ? 1 : 0;
+
+		// Taylor matrix of a single particle inside the derivative-major columns
+		struct StridedMatrix
+		{
+			Vector3D * data;
+			std::size_t stride;
+
+			Vector3D & operator[](const std::size_t derivative) const { return data[derivative * stride]; }
+		};
+
+		std::size_t numberOfParticles = 0;
+		std::size_t taylorOrder = 0;
+
+		std::vector<Vector3D> positionMatrix;		// (taylorOrder + 1) x numberOfParticles
+		std::vector<Vector3D> orientationMatrix;	// (taylorOrder + 1) x numberOfParticles
+		std::vector<std::size_t> particleTaylorOrder;
+
+		std::vector<Vector3D> bodyForce;
+		std::vector<Vector3D> contactForce;
+		std::vector<Vector3D> resultingTorque;
+
+		std::vector<double> mass;
+		std::vector<double> momentOfInertia;
+		std::vector<double> radius;
+};
+
+} // psin
+
+#include <ParticleStore.tpp>
+
+#endif // PARTICLE_STORE_HPP
@@ -0,0 +1,219 @@
+#ifndef PARTICLE_STORE_TPP
+#define PARTICLE_STORE_TPP
+
+// EntityLib
+#include <FixedOrderSpatialEntity.hpp>
+#include <PhysicalEntity.hpp>
+#include <SphericalParticle.hpp>
+
+// InteractionLib
+#include <Interaction.hpp>
+
+// PropertyLib
+#include <PropertyDefinitions.hpp>
+
+// Standard
+#include <algorithm>
+#include <stdexcept>
+
+namespace psin {
+
+template<typename ParticleType>
+void ParticleStore<ParticleType>::bind(std::vector<ParticleType> & particles)
+{
+	this->unbind(particles);
+
+	std::size_t maxTaylorOrder = 0;
+	for(auto&& particle : particles)
+	{
+		const std::size_t order = particle.getTaylorOrder();
+		if(
+			order < orientationOffset
+			or not GearIntegrator::hasCorrector(2, order)
+			or not GearIntegrator::hasCorrector(orientationEquationOrder, order - orientationOffset)
+		)
+		{
+			throw std::invalid_argument("There is no support for this prediction order.");
+		}
+
+		maxTaylorOrder = std::max(maxTaylorOrder, order);
+	}
+
+	numberOfParticles = particles.size();
+	taylorOrder = maxTaylorOrder;
+
+	positionMatrix.assign((taylorOrder + 1) * numberOfParticles, Vector3D());
+	orientationMatrix.assign((taylorOrder + 1) * numberOfParticles, Vector3D());
+	particleTaylorOrder.assign(numberOfParticles, 0);
+
+	bodyForce.assign(numberOfParticles, Vector3D());
+	contactForce.assign(numberOfParticles, Vector3D());
+	resultingTorque.assign(numberOfParticles, Vector3D());
+
+	mass.assign(numberOfParticles, 0.0);
+	momentOfInertia.assign(numberOfParticles, 0.0);
+	radius.assign(numberOfParticles, 0.0);
+
+	for(std::size_t i = 0; i < numberOfParticles; ++i)
+	{
+		ParticleType & particle = particles[i];
+
+		particleTaylorOrder[i] = particle.getTaylorOrder();
+
+		mass[i] = particle.template get<Mass>();
+		momentOfInertia[i] = particle.template get<MomentOfInertia>();
+		if constexpr(has_property<ParticleType, Radius>::value)
+		{
+			if(particle.template assigned<Radius>()) radius[i] = particle.template get<Radius>();
+		}
+
+		particle.bindSpatialStorage(&positionMatrix[i], &orientationMatrix[i], numberOfParticles, taylorOrder);
+		particle.bindDynamicsStorage(&bodyForce[i], &contactForce[i], &resultingTorque[i]);
+	}
+}
+
+template<typename ParticleType>
+void ParticleStore<ParticleType>::unbind(std::vector<ParticleType> & particles)
+{
+	for(auto& particle : particles)
+	{
+		particle.unbindSpatialStorage();
+		particle.unbindDynamicsStorage();
+	}
+}
+
+template<typename ParticleType>
+std::size_t ParticleStore<ParticleType>::size() const
+{
+	return this->numberOfParticles;
+}
+
+template<typename ParticleType>
+std::size_t ParticleStore<ParticleType>::getTaylorOrder() const
+{
+	return this->taylorOrder;
+}
+
+template<typename ParticleType>
+Vector3D * ParticleStore<ParticleType>::position(const std::size_t derivative)
+{
+	return positionMatrix.data() + derivative * numberOfParticles;
+}
+
+template<typename ParticleType>
+Vector3D * ParticleStore<ParticleType>::orientation(const std::size_t derivative)
+{
+	return orientationMatrix.data() + derivative * numberOfParticles;
+}
+
+template<typename ParticleType>
+const std::vector<double> & ParticleStore<ParticleType>::getRadii() const
+{
+	return radius;
+}
+
+template<typename ParticleType>
+Vector3D * ParticleStore<ParticleType>::bodyForceColumn()
+{
+	return bodyForce.data();
+}
+
+template<typename ParticleType>
+Vector3D * ParticleStore<ParticleType>::contactForceColumn()
+{
+	return contactForce.data();
+}
+
+template<typename ParticleType>
+Vector3D * ParticleStore<ParticleType>::torqueColumn()
+{
+	return resultingTorque.data();
+}
+
+template<typename ParticleType>
+void ParticleStore<ParticleType>::resetForces()
+{
+	this->resetForces(0, numberOfParticles);
+}
+
+template<typename ParticleType>
+void ParticleStore<ParticleType>::resetForces(const std::size_t begin, const std::size_t end)
+{
+	std::fill(bodyForce.begin() + begin, bodyForce.begin() + end, nullVector3D());
+	std::fill(contactForce.begin() + begin, contactForce.begin() + end, nullVector3D());
+	std::fill(resultingTorque.begin() + begin, resultingTorque.begin() + end, nullVector3D());
+}
+
+// Same expansion as Interaction<>::taylorPredictor, evaluated derivative by derivative over all particles.
+// Derivatives above a particle's Taylor order are null, so they do not contribute.
+template<typename ParticleType>
+void ParticleStore<ParticleType>::predict(const GearIntegrator::Coefficients & coefficients)
+{
+	this->predict(coefficients, 0, numberOfParticles);
+}
+
+template<typename ParticleType>
+void ParticleStore<ParticleType>::predict(const GearIntegrator::Coefficients & coefficients, const std::size_t begin, const std::size_t end)
+{
+	const GearIntegrator::CoefficientRow & taylorCoefficients = coefficients.predictor();
+
+	for(std::size_t i = 0; i <= taylorOrder; ++i)
+	{
+		Vector3D * predictedPosition = this->position(i);
+		Vector3D * predictedOrientation = this->orientation(i);
+
+		for(std::size_t j = i + 1; j <= taylorOrder; ++j)
+		{
+			const double coefficient = taylorCoefficients[j - i];
+			const Vector3D * currentPosition = this->position(j);
+			const Vector3D * currentOrientation = this->orientation(j);
+
+			for(std::size_t particle = begin; particle < end; ++particle)
+			{
+				predictedPosition[particle] += coefficient * currentPosition[particle];
+				predictedOrientation[particle] += coefficient * currentOrientation[particle];
+			}
+		}
+	}
+}
+
+// Same correction as Interaction<>::gearCorrector, dispatched to the particle's Taylor order so
+// that every loop has a fixed length. For spherical particles, the orientation is corrected as a
+// first order equation on the angular velocity and its derivatives, leaving the orientation untouched.
+template<typename ParticleType>
+void ParticleStore<ParticleType>::correct(const GearIntegrator::Coefficients & coefficients)
+{
+	this->correct(coefficients, 0, numberOfParticles);
+}
+
+template<typename ParticleType>
+void ParticleStore<ParticleType>::correct(const GearIntegrator::Coefficients & coefficients, const std::size_t begin, const std::size_t end)
+{
+	for(std::size_t particle = begin; particle < end; ++particle)
+	{
+		const Vector3D acceleration = (bodyForce[particle] + contactForce[particle]) / mass[particle];
+		const Vector3D angularAcceleration = resultingTorque[particle] / momentOfInertia[particle];
+
+		dispatchTaylorOrder(particleTaylorOrder[particle], [&, this](auto TaylorOrder)
+		{
+			constexpr std::size_t N = decltype(TaylorOrder)::value;
+			if constexpr(N >= 2)
+			{
+				Interaction<>::gearCorrect<2, N>(
+					StridedMatrix{this->position(0) + particle, numberOfParticles},
+					acceleration,
+					coefficients.corrector(2, N)
+				);
+				Interaction<>::gearCorrect<orientationEquationOrder, N - orientationOffset>(
+					StridedMatrix{this->orientation(orientationOffset) + particle, numberOfParticles},
+					angularAcceleration,
+					coefficients.corrector(orientationEquationOrder, N - orientationOffset)
+				);
+			}
+		});
+	}
+}
+
+} // psin
+
+#endif // PARTICLE_STORE_TPP
@@ -0,0 +1,130 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+// UtilsLib
+#include <FileSystem.hpp>
+#include <string.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace psin {
+
+// Profiling is compiled in only when PSIN_PROFILING is defined, as the CMake option of the
+// same name does. Otherwise Profiler does nothing and every call to it compiles away.
+namespace profiling {
+
+#ifdef PSIN_PROFILING
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif
+
+} // profiling
+
+template<bool Enabled>
+class BasicProfiler;
+
+// BasicProfiler<true> measures how long the phases of a time step take with a steady clock.
+// A phase is named by the arguments given to time(), joined by "/". Its time is summed over a
+// step, and endStep() records the sums of the phases that ran during the step, so that the report
+// gives each phase's total time and the distribution of its time per step.
+//
+// A profiler must only be used by one thread at a time.
+template<>
+class BasicProfiler<true>
+{
+	public:
+		using Clock = std::chrono::steady_clock;
+		constexpr static bool enabled = true;
+
+		// Scope adds the time between its construction and its destruction to a phase
+		class Scope
+		{
+			public:
+				Scope(BasicProfiler & profiler, const std::size_t phase);
+				Scope(Scope && other);
+				~Scope();
+
+				Scope(const Scope &) = delete;
+				Scope & operator=(const Scope &) = delete;
+				Scope & operator=(Scope &&) = delete;
+
+			private:
+				BasicProfiler * profiler;
+				std::size_t phase;
+				Clock::time_point start;
+		};
+
+		template<typename ... Names>
+		Scope time(const Names & ... names);
+
+		void endStep();
+		std::size_t getNumberOfSteps() const;
+
+		// Totals, means per step and percentiles of each phase's time per step, in seconds, with
+		// phases in the order they were first timed. Percentiles are read from a histogram whose
+		// bins are 1/16 of an octave wide, so they are within 5% of the exact ones.
+		json report() const;
+
+	private:
+		struct Phase
+		{
+			string name;
+			Clock::duration step = Clock::duration::zero();
+			unsigned long stepCalls = 0;
+
+			unsigned long calls = 0;
+			unsigned long steps = 0;
+			Clock::duration total = Clock::duration::zero();
+			Clock::duration min = Clock::duration::max();
+			Clock::duration max = Clock::duration::zero();
+			std::vector<unsigned long> histogram;
+		};
+
+		void add(const std::size_t phase, const Clock::duration duration);
+		std::size_t phaseOf(const string & name);
+
+		std::vector<Phase> phases;
+		std::map<string, std::size_t> phaseIndices;
+		string name;	// reused to build phase names without allocating
+		std::size_t numberOfSteps = 0;
+};
+
+template<>
+class BasicProfiler<false>
+{
+	public:
+		constexpr static bool enabled = false;
+
+		struct Scope
+		{
+			~Scope() {}
+		};
+
+		template<typename ... Names>
+		Scope time(const Names & ...) { return Scope{}; }
+
+		void endStep() {}
+		std::size_t getNumberOfSteps() const { return 0; }
+		json report() const { return json::object(); }
+};
+
+using Profiler = BasicProfiler<profiling::enabled>;
+
+// Writes profiler's report, and outputProfiler's under "Output", to filePath
+template<bool Enabled>
+void write_profile(const path & filePath, const BasicProfiler<Enabled> & profiler, const BasicProfiler<Enabled> & outputProfiler);
+
+} // psin
+
+#include <Profiler.tpp>
+
+#endif // PROFILER_HPP
@@ -0,0 +1,37 @@
+namespace psin {
+
+namespace detail {
+
+inline void append_phase_name(string & name, const string & part)
+{
+	if(not name.empty()) name += '/';
+	name += part;
+}
+
+inline void append_phase_name(string & name, const char * part)
+{
+	if(not name.empty()) name += '/';
+	name += part;
+}
+
+} // detail
+
+template<typename ... Names>
+BasicProfiler<true>::Scope BasicProfiler<true>::time(const Names & ... names)
+{
+	this->name.clear();
+	(detail::append_phase_name(this->name, names), ...);
+	return Scope(*this, this->phaseOf(this->name));
+}
+
+template<bool Enabled>
+void write_profile(const path & filePath, const BasicProfiler<Enabled> & profiler, const BasicProfiler<Enabled> & outputProfiler)
+{
+	json profile = profiler.report();
+	profile["Clock"] = "steady_clock";
+	profile["Output"] = outputProfiler.report();
+
+	std::ofstream(filePath.string()) << profile.dump(4) << std::endl;
+}
+
+} // psin
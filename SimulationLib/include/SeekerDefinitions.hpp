@@ -2,5 +2,7 @@
 #define SEEKER_DEFINITIONS_HPP
 
 #include <SeekerDefinitions/BlindSeeker.hpp>
+#include <SeekerDefinitions/GridSeeker.hpp>
+#include <SeekerDefinitions/VerletSeeker.hpp>
 
 #endif // SEEKER_DEFINITIONS_HPP
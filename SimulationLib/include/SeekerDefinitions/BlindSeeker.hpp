@@ -3,11 +3,38 @@
 
 #include <InteractionDefinitions.hpp>
 
+// JSONLib
+#include <json.hpp>
+
+// UtilsLib
+#include <NamedType.hpp>
+
 namespace psin {
-	
+
+// A seeker decides which pairs of particles are handed to an interaction.
+// Every seeker provides:
+//		setup(j): reads the seeker's settings, given as "Seeker": { "<SeekerName>": j } in main.json;
+//		update(particleVectorTuple): called once per time step, after the prediction;
+//		for_each_candidate<EntityType, NeighborType>(particleVectorTuple, function): calls function(entity, neighbor)
+//			for every candidate pair. When EntityType and NeighborType are the same, each pair is visited only once;
+//		summary(): statistics reported at the end of the simulation.
+
+// BlindSeeker visits every possible pair of particles
 struct BlindSeeker
-{};
+{
+	void setup(const json & j);
+
+	template<typename ParticleVectorTuple>
+	void update(const ParticleVectorTuple & particleVectorTuple);
+
+	template<typename EntityType, typename NeighborType, typename ParticleVectorTuple, typename Function>
+	void for_each_candidate(ParticleVectorTuple & particleVectorTuple, Function && function) const;
+
+	json summary() const;
+};
 
 } // psin
 
+#include <SeekerDefinitions/BlindSeeker.tpp>
+
 #endif // BLIND_SEEKER_HPP
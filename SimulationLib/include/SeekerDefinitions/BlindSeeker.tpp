@@ -0,0 +1,45 @@
+#ifndef BLIND_SEEKER_TPP
+#define BLIND_SEEKER_TPP
+
+// Standard
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace psin {
+
+template<typename ParticleVectorTuple>
+void BlindSeeker::update(const ParticleVectorTuple & particleVectorTuple)
+{}
+
+template<typename EntityType, typename NeighborType, typename ParticleVectorTuple, typename Function>
+void BlindSeeker::for_each_candidate(ParticleVectorTuple & particleVectorTuple, Function && function) const
+{
+	if constexpr(std::is_same<EntityType, NeighborType>::value)
+	{
+		auto& entities = std::get<std::vector<EntityType>>(particleVectorTuple);
+
+		for(auto entity_it = entities.begin(); entity_it != entities.end(); ++entity_it)
+		{
+			for(auto neighbor_it = std::next(entity_it); neighbor_it != entities.end(); ++neighbor_it)
+			{
+				function(*entity_it, *neighbor_it);
+			}
+		}
+	}
+	else
+	{
+		for(auto& entity : std::get<std::vector<EntityType>>(particleVectorTuple))
+		{
+			for(auto& neighbor : std::get<std::vector<NeighborType>>(particleVectorTuple))
+			{
+				function(entity, neighbor);
+			}
+		}
+	}
+}
+
+} // psin
+
+#endif // BLIND_SEEKER_TPP
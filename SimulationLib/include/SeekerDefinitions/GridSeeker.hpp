@@ -0,0 +1,80 @@
+#ifndef GRID_SEEKER_HPP
+#define GRID_SEEKER_HPP
+
+#include <InteractionDefinitions.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// SimulationLib
+#include <SeekerDefinitions/BlindSeeker.hpp>
+
+// UtilsLib
+#include <NamedType.hpp>
+#include <Vector3D.hpp>
+
+// Standard
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psin {
+
+// GridSeeker sorts particles into a uniform grid of cubic cells whose edge is
+// the largest particle diameter plus an optional margin. Two particles can only
+// touch each other if they lie in the same or in adjacent cells, so only those
+// pairs are visited. Particles without a Radius are handled as BlindSeeker would.
+class GridSeeker
+{
+public:
+	using cell_index = std::array<long, 3>;
+
+	explicit GridSeeker(const double margin = 0.0);
+
+	void setup(const json & j);
+
+	template<typename ... ParticleTypes>
+	void update(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple);
+
+	template<typename EntityType, typename NeighborType, typename ParticleVectorTuple, typename Function>
+	void for_each_candidate(ParticleVectorTuple & particleVectorTuple, Function && function) const;
+
+	double getCellSize() const;
+
+	json summary() const;
+
+private:
+	static cell_index cellOf(const Vector3D & position, const double cellSize);
+
+	struct cell_hash
+	{
+		std::size_t operator()(const cell_index & cell) const;
+	};
+
+	// Particle indices sorted by cell, and the range each occupied cell spans in that ordering
+	struct CellList
+	{
+		std::vector< std::pair<cell_index, std::size_t> > entries;
+		std::unordered_map< cell_index, std::pair<std::size_t, std::size_t>, cell_hash > ranges;
+
+		void build(const std::vector<Vector3D> & positions, const double cellSize);
+	};
+
+	template<typename ParticleType>
+	const CellList & cellList() const;
+
+	double margin;
+	double cellSize = 0.0;
+	std::unordered_map< std::type_index, CellList > cellLists;
+	std::vector<Vector3D> positionBuffer;
+};
+
+} // psin
+
+#include <SeekerDefinitions/GridSeeker.tpp>
+
+#endif // GRID_SEEKER_HPP
@@ -0,0 +1,113 @@
+#ifndef GRID_SEEKER_TPP
+#define GRID_SEEKER_TPP
+
+// EntityLib
+#include <PhysicalEntity.hpp>
+
+// PropertyLib
+#include <PropertyDefinitions.hpp>
+
+// UtilsLib
+#include <mp/for_each.hpp>
+#include <mp/get.hpp>
+#include <mp/type_list.hpp>
+
+// Standard
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+
+namespace psin {
+
+template<typename ... ParticleTypes>
+void GridSeeker::update(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple)
+{
+	using ParticleList = mp::type_list<ParticleTypes...>;
+
+	double maxRadius = 0.0;
+	mp::for_each< mp::provide_indices<ParticleList> >(
+	[&](auto Index)
+	{
+		using P = typename mp::get<Index, ParticleList>::type;
+		if constexpr(has_property<P, Radius>::value)
+		{
+			for(auto&& particle : std::get<std::vector<P>>(particleVectorTuple))
+			{
+				maxRadius = std::max(maxRadius, particle.template get<Radius>());
+			}
+		}
+	});
+	this->cellSize = maxRadius > 0.0 ? 2 * maxRadius + margin : 0.0;
+
+	if(cellSize > 0.0)
+	{
+		mp::for_each< mp::provide_indices<ParticleList> >(
+		[&, this](auto Index)
+		{
+			using P = typename mp::get<Index, ParticleList>::type;
+			if constexpr(has_property<P, Radius>::value)
+			{
+				positionBuffer.clear();
+				for(auto&& particle : std::get<std::vector<P>>(particleVectorTuple))
+				{
+					positionBuffer.push_back(particle.getPosition());
+				}
+				cellLists[std::type_index(typeid(P))].build(positionBuffer, cellSize);
+			}
+		});
+	}
+}
+
+template<typename ParticleType>
+const GridSeeker::CellList & GridSeeker::cellList() const
+{
+	return cellLists.at(std::type_index(typeid(ParticleType)));
+}
+
+template<typename EntityType, typename NeighborType, typename ParticleVectorTuple, typename Function>
+void GridSeeker::for_each_candidate(ParticleVectorTuple & particleVectorTuple, Function && function) const
+{
+	if constexpr(has_property<EntityType, Radius>::value and has_property<NeighborType, Radius>::value)
+	{
+		if(cellSize > 0.0)
+		{
+			auto& entities = std::get<std::vector<EntityType>>(particleVectorTuple);
+			auto& neighbors = std::get<std::vector<NeighborType>>(particleVectorTuple);
+			const CellList & entityCells = this->template cellList<EntityType>();
+			const CellList & neighborCells = this->template cellList<NeighborType>();
+
+			for(auto&& entry : entityCells.entries)
+			{
+				const cell_index & cell = entry.first;
+				const std::size_t entityIndex = entry.second;
+
+				for(long dx = -1; dx <= 1; ++dx)
+				for(long dy = -1; dy <= 1; ++dy)
+				for(long dz = -1; dz <= 1; ++dz)
+				{
+					auto range = neighborCells.ranges.find( cell_index{{cell[0] + dx, cell[1] + dy, cell[2] + dz}} );
+					if(range == neighborCells.ranges.end()) continue;
+
+					for(std::size_t k = range->second.first; k != range->second.second; ++k)
+					{
+						const std::size_t neighborIndex = neighborCells.entries[k].second;
+
+						// Same type: visit each unordered pair once, with the lower index as the entity
+						if(std::is_same<EntityType, NeighborType>::value and neighborIndex <= entityIndex) continue;
+
+						function(entities[entityIndex], neighbors[neighborIndex]);
+					}
+				}
+			}
+
+			return;
+		}
+	}
+
+	BlindSeeker().template for_each_candidate<EntityType, NeighborType>(particleVectorTuple, function);
+}
+
+} // psin
+
+#endif // GRID_SEEKER_TPP
@@ -0,0 +1,92 @@
+#ifndef VERLET_SEEKER_HPP
+#define VERLET_SEEKER_HPP
+
+#include <InteractionDefinitions.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// SimulationLib
+#include <SeekerDefinitions/BlindSeeker.hpp>
+#include <SeekerDefinitions/GridSeeker.hpp>
+
+// UtilsLib
+#include <NamedType.hpp>
+#include <Vector3D.hpp>
+
+// Standard
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psin {
+
+// VerletSeeker keeps, for each particle, the list of particles closer than the
+// sum of their radii plus a skin distance. The lists are only rebuilt once some
+// particle has moved more than half the skin since the last build: until then,
+// no pair left out of the lists can have come into contact.
+// Particles without a Radius are handled as BlindSeeker would.
+//
+// Unless a "Skin" is given, the skin is defaultRelativeSkin times the smallest particle radius,
+// worked out again at every rebuild. A skin of 0 would rebuild the lists whenever a particle moves.
+class VerletSeeker
+{
+public:
+	// Skin, relative to the smallest particle radius, used when none is given
+	constexpr static double defaultRelativeSkin = 0.5;
+
+	VerletSeeker();
+	explicit VerletSeeker(const double skin); // throws
+
+	void setup(const json & j);
+
+	template<typename ... ParticleTypes>
+	void update(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple);
+
+	template<typename EntityType, typename NeighborType, typename ParticleVectorTuple, typename Function>
+	void for_each_candidate(ParticleVectorTuple & particleVectorTuple, Function && function) const;
+
+	double getSkin() const;
+	unsigned long getRebuildCount() const;
+
+	json summary() const;
+
+private:
+	// The neighbors of entity i are neighbors[begin[i]], ..., neighbors[begin[i+1] - 1]
+	struct NeighborList
+	{
+		std::vector<std::size_t> begin;
+		std::vector<std::size_t> neighbors;
+
+		void build(std::vector< std::pair<std::size_t, std::size_t> > & pairs, const std::size_t numberOfEntities);
+	};
+
+	template<typename ... ParticleTypes>
+	bool needsRebuild(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple) const;
+
+	template<typename ... ParticleTypes>
+	void rebuild(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple);
+
+	template<typename ... ParticleTypes>
+	static double smallestRadius(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple);
+
+	double skin = 0.0;
+	bool fixedSkin = false;
+	unsigned long rebuildCount = 0;
+	unsigned long updateCount = 0;
+
+	GridSeeker grid;
+	std::unordered_map< std::type_index, std::vector<Vector3D> > referencePositions;
+	std::map< std::pair<std::type_index, std::type_index>, NeighborList > neighborLists;
+	std::vector< std::pair<std::size_t, std::size_t> > pairBuffer;
+};
+
+} // psin
+
+#include <SeekerDefinitions/VerletSeeker.tpp>
+
+#endif // VERLET_SEEKER_HPP
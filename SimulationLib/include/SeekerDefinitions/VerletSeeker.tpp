@@ -0,0 +1,175 @@
+#ifndef VERLET_SEEKER_TPP
+#define VERLET_SEEKER_TPP
+
+// EntityLib
+#include <PhysicalEntity.hpp>
+
+// PropertyLib
+#include <PropertyDefinitions.hpp>
+
+// UtilsLib
+#include <mp/for_each.hpp>
+#include <mp/get.hpp>
+#include <mp/type_list.hpp>
+
+// Standard
+#include <algorithm>
+#include <limits>
+#include <typeinfo>
+
+namespace psin {
+
+template<typename ... ParticleTypes>
+void VerletSeeker::update(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple)
+{
+	++updateCount;
+
+	if(needsRebuild(particleVectorTuple))
+	{
+		rebuild(particleVectorTuple);
+	}
+}
+
+template<typename ... ParticleTypes>
+bool VerletSeeker::needsRebuild(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple) const
+{
+	using ParticleList = mp::type_list<ParticleTypes...>;
+
+	if(rebuildCount == 0) return true;
+
+	bool rebuildFlag = false;
+	mp::for_each< mp::provide_indices<ParticleList> >(
+	[&, this](auto Index)
+	{
+		using P = typename mp::get<Index, ParticleList>::type;
+		if constexpr(has_property<P, Radius>::value)
+		{
+			const auto& particleVector = std::get<std::vector<P>>(particleVectorTuple);
+			const auto reference = referencePositions.find(std::type_index(typeid(P)));
+
+			if(reference == referencePositions.end() or reference->second.size() != particleVector.size())
+			{
+				rebuildFlag = true;
+				return;
+			}
+
+			for(std::size_t i = 0; i < particleVector.size() and not rebuildFlag; ++i)
+			{
+				if(particleVector[i].getPosition().dist(reference->second[i]) > skin / 2)
+				{
+					rebuildFlag = true;
+				}
+			}
+		}
+	});
+
+	return rebuildFlag;
+}
+
+template<typename ... ParticleTypes>
+void VerletSeeker::rebuild(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple)
+{
+	using ParticleList = mp::type_list<ParticleTypes...>;
+
+	++rebuildCount;
+	if(not fixedSkin)
+	{
+		skin = defaultRelativeSkin * smallestRadius(particleVectorTuple);
+		grid = GridSeeker(skin);
+	}
+	grid.update(particleVectorTuple);
+
+	mp::for_each< mp::provide_indices<ParticleList> >(
+	[&, this](auto EntityIndex)
+	{
+		using EntityType = typename mp::get<EntityIndex, ParticleList>::type;
+		if constexpr(has_property<EntityType, Radius>::value)
+		{
+			const auto& entities = std::get<std::vector<EntityType>>(particleVectorTuple);
+
+			std::vector<Vector3D> & reference = referencePositions[std::type_index(typeid(EntityType))];
+			reference.clear();
+			for(auto&& entity : entities)
+			{
+				reference.push_back(entity.getPosition());
+			}
+
+			mp::for_each< mp::provide_indices<ParticleList> >(
+			[&, this](auto NeighborIndex)
+			{
+				using NeighborType = typename mp::get<NeighborIndex, ParticleList>::type;
+				if constexpr(has_property<NeighborType, Radius>::value)
+				{
+					const auto& neighbors = std::get<std::vector<NeighborType>>(particleVectorTuple);
+
+					pairBuffer.clear();
+					grid.template for_each_candidate<EntityType, NeighborType>(particleVectorTuple,
+						[&, this](const EntityType & entity, const NeighborType & neighbor)
+						{
+							const double cutoff = entity.template getUnchecked<Radius>() + neighbor.template getUnchecked<Radius>() + skin;
+							if(entity.getPosition().dist(neighbor.getPosition()) < cutoff)
+							{
+								pairBuffer.emplace_back(&entity - entities.data(), &neighbor - neighbors.data());
+							}
+						});
+
+					neighborLists[std::make_pair(std::type_index(typeid(EntityType)), std::type_index(typeid(NeighborType)))]
+						.build(pairBuffer, entities.size());
+				}
+			});
+		}
+	});
+}
+
+// 0 if no particle has a Radius
+template<typename ... ParticleTypes>
+double VerletSeeker::smallestRadius(const std::tuple< std::vector<ParticleTypes>... > & particleVectorTuple)
+{
+	using ParticleList = mp::type_list<ParticleTypes...>;
+
+	double radius = std::numeric_limits<double>::infinity();
+	mp::for_each< mp::provide_indices<ParticleList> >(
+	[&](auto Index)
+	{
+		using P = typename mp::get<Index, ParticleList>::type;
+		if constexpr(has_property<P, Radius>::value)
+		{
+			for(auto&& particle : std::get<std::vector<P>>(particleVectorTuple))
+			{
+				radius = std::min(radius, particle.template getUnchecked<Radius>());
+			}
+		}
+	});
+
+	return radius < std::numeric_limits<double>::infinity() ? radius : 0.0;
+}
+
+template<typename EntityType, typename NeighborType, typename ParticleVectorTuple, typename Function>
+void VerletSeeker::for_each_candidate(ParticleVectorTuple & particleVectorTuple, Function && function) const
+{
+	if constexpr(has_property<EntityType, Radius>::value and has_property<NeighborType, Radius>::value)
+	{
+		const auto list = neighborLists.find(std::make_pair(std::type_index(typeid(EntityType)), std::type_index(typeid(NeighborType))));
+		if(list != neighborLists.end())
+		{
+			auto& entities = std::get<std::vector<EntityType>>(particleVectorTuple);
+			auto& neighbors = std::get<std::vector<NeighborType>>(particleVectorTuple);
+
+			for(std::size_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex)
+			{
+				for(std::size_t k = list->second.begin[entityIndex]; k != list->second.begin[entityIndex + 1]; ++k)
+				{
+					function(entities[entityIndex], neighbors[list->second.neighbors[k]]);
+				}
+			}
+
+			return;
+		}
+	}
+
+	BlindSeeker().template for_each_candidate<EntityType, NeighborType>(particleVectorTuple, function);
+}
+
+} // psin
+
+#endif // VERLET_SEEKER_TPP
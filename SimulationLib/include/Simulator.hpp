@@ -2,11 +2,27 @@
 #define SIMULATOR_HPP
 
 // InteractionLib
+#include <ContactHistory.hpp>
 #include <Interaction.hpp>
 
+// IOLib
+#include <AsyncWriter.hpp>
+#include <Checkpoint.hpp>
+#include <CompressedFrameWriter.hpp>
+#include <FrameWriter.hpp>
+#include <OutputBuffer.hpp>
+#include <TimeIndexWriter.hpp>
+#include <TrajectoryWriter.hpp>
+#include <VtkWriter.hpp>
+
 // SimulationLib
 #include <InteractionSubjectLister.hpp>
 #include <IntegratorDefinitions.hpp>
+#include <InteractionStatistics.hpp>
+#include <OutputField.hpp>
+#include <PairEvaluator.hpp>
+#include <ParticleStore.hpp>
+#include <Profiler.hpp>
 #include <SeekerDefinitions.hpp>
 #include <SimulationFileTree.hpp>
 
@@ -15,6 +31,9 @@
 #include <Named.hpp>
 #include <Vector3D.hpp>
 #include <string.hpp>
+#include <ThreadPool.hpp>
+#include <Tracer.hpp>
+#include <UniquePointer.hpp>
 
 // Standard
 #include <tuple>
@@ -40,14 +59,15 @@ class Simulator;
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 class Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 > : public Named
 {
 public:
@@ -55,13 +75,17 @@ public:
 	using BoundaryList = psin::BoundaryList<BoundaryTypes...>;
 	using InteractionList = psin::InteractionList<InteractionTypes...>;
 	using IntegratorList = psin::IntegratorList<GearIntegrator>;
-	using SeekerList = psin::SeekerList<BlindSeeker>;
+	using SeekerList = psin::SeekerList<SeekerTypes...>;
 	using InteractionParticleParticleTriplets = typename InteractionSubjectLister::generate_combinations<InteractionList, ParticleList, ParticleList>::type;
 	using InteractionParticleBoundaryTriplets = typename InteractionSubjectLister::generate_combinations<InteractionList, ParticleList, BoundaryList>::type;
 
 	void setup(const path & mainInputFilePath);
+	// Same as above, from the contents of a main input file. Particles, boundaries and interactions
+	// given as objects are built in memory; those given as file paths are read from disk.
+	void setup(const json & mainInput);
 
 	void setupInteractions(const json & interactionsJSON);
+	void setNumberOfThreads(const unsigned numberOfThreads); // throws
 	void buildParticles(const json & particlesJSON);
 	void buildBoundaries(const json & boundariesJSON);
 
@@ -77,9 +101,18 @@ public:
 	void exportTime(const bool first);
 	void exportParticles(const bool first);
 	void exportBoundaries(const bool first);
+	// Exports the frames in the output buffer and empties it. Runs on the output writer's thread,
+	// or after outputWriter.wait().
+	void exportOutputBuffer();
 
 	void printSuccessMessage() const;
 
+	// Checkpoints
+	template<typename Time> void writeCheckpoint(const Time & time, const unsigned long stepsForStoringCounter, const unsigned long storagesForWritingCounter) const; // throws
+	// Restores the state saved by writeCheckpoint. Particles, boundaries, interactions and output folders
+	// must already be set up. Throws if an output folder holds files, so that they are not overwritten.
+	void restart(const path & checkpointFilePath); // throws
+
 	// Simulate
 	void simulate();
 	template<typename Time> void endSimulation(const Time & time);
@@ -91,9 +124,43 @@ private:
 	std::map<string, unique_ptr<std::fstream>> particleFileMap;
 	std::map<string, unique_ptr<std::fstream>> boundaryFileMap;
 
-	vector<json> timeJsonVector;
-	std::map<string, vector<json>> particleJsonMap;
-	std::map<string, vector<json>> boundaryJsonMap;
+	// Time indexes of the JSON files above, with the same keys, so that their
+	// entries can be read with an IndexedJsonReader
+	std::map<string, TimeIndexWriter> mainIndexMap;
+	std::map<string, TimeIndexWriter> particleIndexMap;
+	std::map<string, TimeIndexWriter> boundaryIndexMap;
+
+	// "Array", which writes each JSON file as an array closed at the end of the simulation, or "Lines",
+	// which writes one entry per line to ".jsonl" files, so that every complete line can be read
+	// while the simulation runs or after it crashes
+	string jsonLayout = "Array";
+
+	// Frames of raw state waiting to be written, and the copies of the entities
+	// that are restored from them to be serialized
+	OutputBuffer outputBuffer;
+	std::tuple< std::vector<ParticleTypes>... > outputParticles;
+	std::tuple< std::vector<BoundaryTypes>... > outputBoundaries;
+	// Whether the JSON files already hold an entry, so that the next one is preceded by a comma.
+	// Only exportOutputBuffer reads and sets it.
+	bool jsonEntriesWritten = false;
+
+	// "JSON", "Binary", which writes a TrajectoryWriter file per particle, "Frames",
+	// which writes every particle to a single FrameWriter file, or "Compressed", which writes
+	// the same frames delta-encoded to a CompressedFrameWriter file
+	string outputFormat = "JSON";
+	// Particle fields stored in each frame. If there are none, JSON output stores whole particles
+	// and binary output stores detail::default_output_fields().
+	std::vector<OutputField> outputFields;
+	std::map<string, TrajectoryWriter> particleTrajectoryMap;
+	FrameWriter particleFrameWriter;
+	CompressedFrameWriter particleCompressedFrameWriter;
+	// Compressed frames are decoded from the last keyframe, written every keyframeInterval frames
+	std::size_t keyframeInterval = CompressedFrameWriter::defaultKeyframeInterval;
+
+	// With VtkOutput, every stored frame is also written as a .vtu point cloud, listed in
+	// particleVtkSeries, and planes are written once as polygons
+	bool vtkOutput = false;
+	VtkSeriesWriter particleVtkSeries;
 
 	double initialInstant;
 	double timeStep;
@@ -102,12 +169,56 @@ private:
 	unsigned long storagesForWriting;
 	bool printTime;
 
+	// A checkpoint is written to fileTree["output"]["checkpoint"] every checkpointInterval time steps,
+	// unless it is zero
+	unsigned long checkpointInterval = 0;
+
+	// Where the time loop resumes from, when restarted from a checkpoint by RestartFrom. A restarted
+	// simulation starts new output files, from the checkpoint's time step on: MainOutputFolder,
+	// ParticleOutputFolder and BoundaryOutputFolder must be empty or not exist yet, and the output
+	// of the interrupted simulation, up to the checkpoint, stays where it was. RestartFrom may name
+	// a checkpoint in the interrupted simulation's MainOutputFolder, where the default CheckpointFile is.
+	bool restarted = false;
+	std::size_t restartTimeIndex = 0;
+	double restartInstant;
+	unsigned long restartStepsForStoringCounter = 0;
+	unsigned long restartStoragesForWritingCounter = 0;
+
 	std::tuple< std::vector<ParticleTypes>... > particles;
+	std::tuple< ParticleStore<ParticleTypes>... > particleStores;
 	std::tuple< std::vector<BoundaryTypes>... > boundaries;
+	std::tuple< SeekerTypes... > seekers;
+	std::tuple< InteractionContactHistory<InteractionTypes>... > contactHistories;
+
+	int nextHandle = 0;
+
+	ThreadPool threadPool;
+	PairEvaluator pairEvaluator{threadPool};
+
+	// Time spent in each phase of the time loop, and in output on the writer thread, written to
+	// profile.json next to main.json when built with PSIN_PROFILING
+	Profiler profiler;
+	Profiler outputProfiler;
+
+	// With a TraceInterval, every TraceInterval-th step is recorded event by event, on every thread,
+	// and written to fileTree["output"]["trace"] as a Chrome trace at the end of the simulation.
+	// Checkpoints, snapshots and exports are recorded in every step.
+	Tracer tracer;
+
+	// With InteractionStatistics, the counters of each interaction triplet and the coordination numbers
+	// of the particles are written to interactionStatistics.json every StepsForStoring time steps
+	bool keepInteractionStatistics = false;
+	InteractionStatistics interactionStatistics;
+	std::fstream interactionStatisticsFile;
+	TimeIndexWriter interactionStatisticsIndex;
 
 	std::set< std::string > interactionsToUse;
 	string integrationAlgorithmToUse;
 	string seekerToUse;
+
+	// Serializes snapshots of the simulation in the background. It is the last member so that it
+	// is destroyed, finishing its pending tasks, before the output maps and files it writes to.
+	AsyncWriter outputWriter;
 };
 
 } // psin
@@ -10,32 +10,67 @@
 // UtilsLib
 #include <FileSystem.hpp>
 #include <NamedType.hpp>
+#include <mp/for_each.hpp>
 #include <mp/visit.hpp>
 
 // Standard
+#include <cstdint>
 #include <fstream>
+#include <stdexcept>
 #include <tuple>
 
 #include <boost/type_index.hpp> // DEBUG
 
 namespace psin {
 
+namespace detail {
+
+template<typename P>
+struct bind_particle_store;
+
+template<typename E>
+struct assign_handles;
+
+template<typename InteractionTriplet>
+struct check_triplet_properties;
+
+} // detail
+
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::setup(const path & mainInputFilePath)
 {
 	fileTree["input"]["main"] = mainInputFilePath;
 
-	json j = read_json(fileTree["input"]["main"]);
+	this->setup( read_json(fileTree["input"]["main"]) );
+}
+
+template<
+	typename ... ParticleTypes,
+	typename ... BoundaryTypes,
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
+>
+void Simulator<
+	ParticleList<ParticleTypes...>,
+	BoundaryList<BoundaryTypes...>,
+	InteractionList<InteractionTypes...>,
+	IntegratorList<GearIntegrator>,
+	SeekerList<SeekerTypes...>
+>::setup(const json & j)
+{
+	// Entities built in memory are recorded as coming from an unnamed file
+	if(fileTree["input"]["main"].is_null()) fileTree["input"]["main"] = path();
 
 	this->initialInstant = j.at("InitialInstant");
 	this->timeStep = j.at("TimeStep");
@@ -43,32 +78,107 @@ void Simulator<
 	this->stepsForStoring = j.at("StepsForStoring");
 	this->storagesForWriting = j.at("StoragesForWriting");
 	this->integrationAlgorithmToUse = j.at("IntegrationAlgorithm");
-	if(j.count("Seeker") > 0) this->seekerToUse = j.at("Seeker");
 	if(j.count("PrintTime") > 0) this->printTime = j.at("PrintTime");
+	if(j.count("NumberOfThreads") > 0) this->setNumberOfThreads( j.at("NumberOfThreads") );
+	if(j.count("DeterministicReduction") > 0) this->pairEvaluator.setDeterministic( j.at("DeterministicReduction") );
+	if(j.count("OutputFormat") > 0) this->outputFormat = j.at("OutputFormat").get<string>();
+	if(this->outputFormat != "JSON" and this->outputFormat != "Binary" and this->outputFormat != "Frames" and this->outputFormat != "Compressed")
+	{
+		throw std::runtime_error("OutputFormat must be either \"JSON\", \"Binary\", \"Frames\" or \"Compressed\".");
+	}
+	if(j.count("KeyframeInterval") > 0) this->keyframeInterval = j.at("KeyframeInterval");
+	if(j.count("JsonLayout") > 0) this->jsonLayout = j.at("JsonLayout").get<string>();
+	if(this->jsonLayout != "Array" and this->jsonLayout != "Lines")
+	{
+		throw std::runtime_error("JsonLayout must be either \"Array\" or \"Lines\".");
+	}
+	if(j.count("OutputQueueCapacity") > 0) this->outputWriter.setCapacity( j.at("OutputQueueCapacity") );
+	if(j.count("OutputByteBudget") > 0) this->outputBuffer.setByteBudget( j.at("OutputByteBudget") );
+	if(j.count("VtkOutput") > 0) this->vtkOutput = j.at("VtkOutput");
+	if(j.count("InteractionStatistics") > 0) this->keepInteractionStatistics = j.at("InteractionStatistics");
+	if(j.count("OutputFields") > 0) this->outputFields = j.at("OutputFields").get<std::vector<OutputField>>();
+
+	// "Seeker" is either the seeker's name or an object { "<SeekerName>": settings }
+	json seekerSettings = json::object();
+	if(j.count("Seeker") == 0) this->seekerToUse = NamedType< typename mp::get<0, SeekerList>::type >::name;
+	else if(j.at("Seeker").is_object())
+	{
+		this->seekerToUse = j.at("Seeker").begin().key();
+		seekerSettings = j.at("Seeker").begin().value();
+	}
+	else this->seekerToUse = j.at("Seeker").get<string>();
+
+	bool seekerFound = false;
+	mp::for_each< mp::provide_indices<SeekerList> >(
+	[&, this](auto Index)
+	{
+		using S = typename mp::get<Index, SeekerList>::type;
+		if( NamedType<S>::name == this->seekerToUse )
+		{
+			std::get<S>(this->seekers).setup(seekerSettings);
+			seekerFound = true;
+		}
+	});
+	if(not seekerFound) throw std::runtime_error("Unknown seeker: " + this->seekerToUse);
 
 	fileTree["output"]["main"] = j.at("MainOutputFolder").get<path>();
 	fileTree["output"]["particleDir"] = j.at("ParticleOutputFolder").get<path>();
 	fileTree["output"]["boundaryDir"] = j.at("BoundaryOutputFolder").get<path>();
 
+	if(j.count("CheckpointInterval") > 0) this->checkpointInterval = j.at("CheckpointInterval");
+	if(j.count("CheckpointFile") > 0) fileTree["output"]["checkpoint"] = j.at("CheckpointFile").get<path>();
+	else fileTree["output"]["checkpoint"] = j.at("MainOutputFolder").get<path>() / path("checkpoint.bin");
+
+	if(j.count("TraceInterval") > 0) this->tracer.setInterval( j.at("TraceInterval") );
+	if(j.count("TraceCapacity") > 0) this->tracer.setCapacity( j.at("TraceCapacity") );
+	if(j.count("TraceFile") > 0) fileTree["output"]["trace"] = j.at("TraceFile").get<path>();
+	else fileTree["output"]["trace"] = j.at("MainOutputFolder").get<path>() / path("trace.json");
+	if(this->tracer.isEnabled()) this->threadPool.setTracer(&this->tracer);
+
 	if(j.count("Interactions") > 0) setupInteractions(j.at("Interactions"));
 
 	if(j.count("Particles") > 0) buildParticles(j.at("Particles"));
 
 	if(j.count("Boundaries") > 0) buildBoundaries(j.at("Boundaries"));
+
+	// Interactions read their properties unchecked, so a missing one would silently read as zero
+	mp::visit<InteractionParticleParticleTriplets, detail::check_triplet_properties>::call_same(particles, particles, interactionsToUse);
+	mp::visit<InteractionParticleBoundaryTriplets, detail::check_triplet_properties>::call_same(particles, boundaries, interactionsToUse);
+
+	if(j.count("RestartFrom") > 0) restart(j.at("RestartFrom").get<path>());
 }
 
 
+// Particle updates (force reset, prediction and correction) and pair interactions are split among numberOfThreads threads
+template<
+	typename ... ParticleTypes,
+	typename ... BoundaryTypes,
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
+>
+void Simulator<
+	ParticleList<ParticleTypes...>,
+	BoundaryList<BoundaryTypes...>,
+	InteractionList<InteractionTypes...>,
+	IntegratorList<GearIntegrator>,
+	SeekerList<SeekerTypes...>
+>::setNumberOfThreads(const unsigned numberOfThreads)
+{
+	this->threadPool.setNumberOfThreads(numberOfThreads);
+}
+
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::setupInteractions(const json & interactionsJSON)
 {
 	std::cout << "Interactions setup" << std::endl; // DEBUG
@@ -140,14 +250,15 @@ void Simulator<
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::buildParticles(const json & particlesJSON)
 {
 	std::cout << "Building particles" << std::endl; // DEBUG
@@ -229,19 +340,25 @@ void Simulator<
 			fileTree["input"]["particle"][particleName] = particleInputFilePath;
 		}
 	}
+
+	mp::visit<ParticleList, detail::assign_handles>::call_same(particles, nextHandle);
+
+	// From now on, particles are views over the stores' contiguous arrays
+	mp::visit<ParticleList, detail::bind_particle_store>::call_same(particles, particleStores);
 }
 
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::buildBoundaries(const json & boundariesJSON)
 {
 	std::cout << "Building boundaries" << std::endl; // DEBUG
@@ -323,19 +440,22 @@ void Simulator<
 			fileTree["input"]["boundary"][boundaryName] = boundaryInputFilePath;
 		}
 	}
+
+	mp::visit<BoundaryList, detail::assign_handles>::call_same(boundaries, nextHandle);
 }
 
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::createDirectories() const
 {
 	filesystem::create_directories( fileTree["output"]["main"] );
@@ -349,14 +469,15 @@ void Simulator<
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::outputMainData()
 {
 	this->createDirectories();
@@ -370,6 +491,20 @@ void Simulator<
 		{"IntegrationAlgorithm", this->integrationAlgorithmToUse},
 		{"Seeker", this->seekerToUse},
 		{"PrintTime", this->printTime},
+		{"NumberOfThreads", this->threadPool.getNumberOfThreads()},
+		{"DeterministicReduction", this->pairEvaluator.isDeterministic()},
+		{"OutputFormat", this->outputFormat},
+		{"KeyframeInterval", this->keyframeInterval},
+		{"JsonLayout", this->jsonLayout},
+		{"VtkOutput", this->vtkOutput},
+		{"InteractionStatistics", this->keepInteractionStatistics},
+		{"OutputQueueCapacity", this->outputWriter.getCapacity()},
+		{"OutputByteBudget", this->outputBuffer.getByteBudget()},
+		{"CheckpointInterval", this->checkpointInterval},
+		{"CheckpointFile", fileTree["output"]["checkpoint"]},
+		{"TraceInterval", this->tracer.getInterval()},
+		{"TraceCapacity", this->tracer.getCapacity()},
+		{"TraceFile", fileTree["output"]["trace"]},
 		{"MainOutputFolder", fileTree["output"]["main"]},
 		{"ParticleOutputFolder", fileTree["output"]["particleDir"]},
 		{"BoundaryOutputFolder", fileTree["output"]["boundaryDir"]},
@@ -377,7 +512,8 @@ void Simulator<
 		{"Particles", fileTree["input"]["particle"]},
 		{"Boundaries", fileTree["input"]["boundary"]}
 	};
-
+	if(not this->outputFields.empty()) mainOutput["OutputFields"] = this->outputFields;
+	if(this->restarted) mainOutput["RestartFrom"] = fileTree["input"]["restart"];
 
 	path mainOutputFilePath = fileTree["output"]["main"] / path("main.json");
 	mainFileMap["main"] = make_unique<std::fstream>(mainOutputFilePath.string(), std::ios::in | std::ios::out | std::ios::trunc);
@@ -387,14 +523,15 @@ void Simulator<
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::backupInteractions() const
 {
 	if(fileTree["input"]["interaction"].is_object())
@@ -415,14 +552,15 @@ void Simulator<
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::backupParticles() const
 {
 	if(fileTree["input"]["particle"].is_object())
@@ -443,14 +581,15 @@ void Simulator<
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::backupBoundaries() const
 {
 	if(fileTree["input"]["boundary"].is_object())
@@ -470,21 +609,45 @@ void Simulator<
 
 namespace detail {
 
+inline string json_extension(const bool jsonLines)
+{
+	return jsonLines ? ".jsonl" : ".json";
+}
+
+// Writes j as the next entry of a JSON output file and indexes it. Array entries are separated by
+// commas; JSON Lines entries are compact and end with a newline, so that a line is only complete
+// once its whole entry has been written.
+inline void write_json_entry(std::fstream & file, TimeIndexWriter & index, const std::size_t timeIndex, const double time, const json & j, const bool firstEntry, const bool jsonLines)
+{
+	if(jsonLines)
+	{
+		index.append(timeIndex, time, file);
+		file << j.dump() << '\n';
+	}
+	else
+	{
+		file << (firstEntry ? "\n" : ",\n");
+		index.append(timeIndex, time, file);
+		file << j.dump(4);
+	}
+}
+
 template<typename P>
 struct open_particle_file
 {
 	template<typename T>
-	static void call(const T & particleVectorTuple, json & fileTree, std::map<string, unique_ptr<std::fstream>> & particleFileMap)
+	static void call(const T & particleVectorTuple, json & fileTree, std::map<string, unique_ptr<std::fstream>> & particleFileMap, std::map<string, TimeIndexWriter> & particleIndexMap, const bool jsonLines)
 	{
 		path particleFolder = fileTree["output"]["particleDir"].get<path>();
 		for(const auto& particle : std::get< vector<P> >(particleVectorTuple))
 		{
-			path particleOutputPath = particleFolder / path(particle.getName() + ".json");
+			path particleOutputPath = particleFolder / path(particle.getName() + json_extension(jsonLines));
 
 			fileTree["output"]["particle"][particle.getName()] = particleOutputPath;
 			particleFileMap[particle.getName()] = make_unique<std::fstream>(particleOutputPath.string(), std::ios::in | std::ios::out | std::ios::trunc);
 			// *particleFileMap[particle.getName()] << json().dump();
-			*particleFileMap[particle.getName()] << "[" << std::flush;			
+			if(not jsonLines) *particleFileMap[particle.getName()] << "[" << std::flush;
+			particleIndexMap[particle.getName()].open(timeindex::indexPathOf(particleOutputPath), json{ {"Stream", particleOutputPath.filename()} });
 		}
 	}
 };
@@ -493,273 +656,211 @@ template<typename B>
 struct open_boundary_file
 {
 	template<typename T>
-	static void call(const T & boundaryVectorTuple, json & fileTree, std::map<string, unique_ptr<std::fstream>> & boundaryFileMap)
+	static void call(const T & boundaryVectorTuple, json & fileTree, std::map<string, unique_ptr<std::fstream>> & boundaryFileMap, std::map<string, TimeIndexWriter> & boundaryIndexMap, const bool jsonLines)
 	{
 		path boundaryFolder = fileTree["output"]["boundaryDir"].get<path>();
 		for(const auto& boundary : std::get< vector<B> >(boundaryVectorTuple))
 		{
-			path boundaryOutputPath = boundaryFolder / path(boundary.getName() + ".json");
+			path boundaryOutputPath = boundaryFolder / path(boundary.getName() + json_extension(jsonLines));
 
 			fileTree["output"]["boundary"][boundary.getName()] = boundaryOutputPath;
 			boundaryFileMap[boundary.getName()] = make_unique<std::fstream>(boundaryOutputPath.string(), std::ios::in | std::ios::out | std::ios::trunc);
 			// *boundaryFileMap[boundary.getName()] << json().dump();
-			*boundaryFileMap[boundary.getName()] << "[" << std::flush;
+			if(not jsonLines) *boundaryFileMap[boundary.getName()] << "[" << std::flush;
+			boundaryIndexMap[boundary.getName()].open(timeindex::indexPathOf(boundaryOutputPath), json{ {"Stream", boundaryOutputPath.filename()} });
 		}
 	}
 };
 
-} // detail
-
-template<
-	typename ... ParticleTypes,
-	typename ... BoundaryTypes,
-	typename ... InteractionTypes
->
-void Simulator<
-	ParticleList<ParticleTypes...>,
-	BoundaryList<BoundaryTypes...>,
-	InteractionList<InteractionTypes...>,
-	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
->::openFiles()
+// Fields of the records written by the binary output format when main.json selects none
+inline const std::vector<OutputField> & default_output_fields()
 {
-	path timeVectorOutputFilePath = fileTree["output"]["main"] / path("timeVector.json");
-	mainFileMap["timeVector"] = make_unique<std::fstream>(timeVectorOutputFilePath.string(), std::ios::in | std::ios::out | std::ios::trunc);
-	// *mainFileMap["timeVector"] << json().dump();
-	*mainFileMap["timeVector"] << "[" << std::flush;
+	static const std::vector<OutputField> fields{
+		OutputField("Position"),
+		OutputField("Velocity"),
+		OutputField("Acceleration"),
+		OutputField("Orientation"),
+		OutputField("AngularVelocity"),
+		OutputField("AngularAcceleration"),
+		OutputField("bodyForce"),
+		OutputField("contactForce"),
+		OutputField("resultingTorque")
+	};
+	return fields;
+}
 
+// The part of a particle's JSON output that does not change during a simulation
+template<typename P>
+json particle_properties(const P & particle)
+{
+	typename P::BasePhysicalEntity physical = particle;
 
-	mp::visit<ParticleList, detail::open_particle_file>::call_same(particles, fileTree, particleFileMap);
-	mp::visit<BoundaryList, detail::open_boundary_file>::call_same(boundaries, fileTree, boundaryFileMap);
+	json j = physical;
+	j["Name"] = particle.getName();
+	j["TaylorOrder"] = particle.getTaylorOrder();
+	return j;
 }
 
-namespace detail {
-
 template<typename P>
-struct write_particles_to_json
+struct open_particle_trajectory
 {
-	template<typename ParticleTuple, typename Time>
-	static void call(const ParticleTuple & particleVectorTuple, std::map<string, vector<json>>& particleJsonMap, const Time & time)
+	template<typename T>
+	static void call(const T & particleVectorTuple, json & fileTree, std::map<string, TrajectoryWriter> & particleTrajectoryMap, const std::vector<OutputField> & outputFields)
 	{
-		for(auto&& particle : std::get< vector<P> >(particleVectorTuple))
+		path particleFolder = fileTree["output"]["particleDir"].get<path>();
+		for(const auto& particle : std::get< vector<P> >(particleVectorTuple))
 		{
-			json j{
-				{time.getIndexTag(), time.getIndex()},
-				{"particleType", NamedType<P>::name},
-				{"particle", particle}
-			};
-			particleJsonMap[particle.getName()].push_back(j);
+			path particleOutputPath = particleFolder / path(particle.getName() + ".bin");
+
+			std::vector<TrajectoryField> fields;
+			for(const OutputField & field : outputFields)
+			{
+				fields.push_back( TrajectoryField{field.getName(), field.getComponents(particle.getTaylorOrder()), field.getType()} );
+			}
+
+			fileTree["output"]["particle"][particle.getName()] = particleOutputPath;
+			particleTrajectoryMap[particle.getName()].open(
+				particleOutputPath,
+				fields,
+				json{
+					{"Name", particle.getName()},
+					{"particleType", NamedType<P>::name},
+					{"Properties", particle_properties(particle)},
+					{"OutputFields", outputFields}
+				}
+			);
 		}
 	}
 };
 
-template<typename B>
-struct write_boundaries_to_json
+template<typename P>
+struct describe_particle_frames
 {
-	template<typename BoundaryTuple, typename Time>
-	static void call(const BoundaryTuple & boundaryVectorTuple, std::map<string, vector<json>>& boundaryJsonMap, const Time & time)
+	template<typename T>
+	static void call(const T & particleVectorTuple, std::vector<FrameEntity> & entities, const std::vector<OutputField> & outputFields)
 	{
-		for(auto&& boundary : std::get< vector<B> >(boundaryVectorTuple))
+		for(const auto& particle : std::get< vector<P> >(particleVectorTuple))
 		{
-			json j{
-				{time.getIndexTag(), time.getIndex()},
-				{"boundaryType", NamedType<B>::name},
-				{"boundary", boundary}
+			FrameEntity entity{particle.getName()};
+			for(const OutputField & field : outputFields)
+			{
+				entity.fields.push_back( TrajectoryField{field.getName(), field.getComponents(particle.getTaylorOrder()), field.getType(), field.getTolerance()} );
+			}
+			entity.description = json{
+				{"particleType", NamedType<P>::name},
+				{"Properties", particle_properties(particle)}
 			};
-			boundaryJsonMap[boundary.getName()].push_back(j);
+
+			entities.push_back(std::move(entity));
 		}
 	}
 };
 
-template<typename P>
-struct predict_particle
+// Point data of the VTK point clouds, as filled by append_particles_to_vtk
+inline std::vector<vtk::DataArray> vtk_point_data()
 {
-	template<typename ParticleTuple, typename Time>
-	static void call(ParticleTuple & particleVectorTuple, const Time & time)
-	{
-		for(auto& particle : std::get<vector<P>>(particleVectorTuple))
-		{
-			vector<Vector3D> predictedPosition = Interaction<>::taylorPredictor(
-					particle.getPositionMatrix(),
-					particle.getTaylorOrder(),
-					time.getTimeStep()
-				);
-			particle.setPositionMatrix(predictedPosition);
-
-			vector<Vector3D> predictedOrientation = Interaction<>::taylorPredictor(
-					particle.getOrientationMatrix(),
-					particle.getTaylorOrder(),
-					time.getTimeStep()
-				);
-			particle.setOrientationMatrix(predictedOrientation);
-		}
-	}
-};
+	return {
+		{"Radius", 1},
+		{"Velocity", 3},
+		{"AngularVelocity", 3},
+		{"Force", 3},
+		{"Color", 3}
+	};
+}
 
-template<typename B>
-struct update_boundary
+inline void append_vector(std::vector<double> & values, const Vector3D & vector)
 {
-	template<typename BoundaryVectorTuple, typename Time>
-	static void call(BoundaryVectorTuple & boundaryVectorTuple, const Time & time)
-	{
-		for(auto& boundary : std::get<vector<B>>(boundaryVectorTuple))
-		{
-			boundary.update(time);
-		}
-	}
-};
+	values.push_back(vector.x());
+	values.push_back(vector.y());
+	values.push_back(vector.z());
+}
 
-template<typename Ofstream>
-Ofstream& operator<<(Ofstream& out, const vector<Vector3D> & v)// DEBUG
+template<typename E>
+Vector3D entity_rgb(const E & entity)
 {
-	for(auto&& entry : v)
+	if constexpr(has_property<E, Color>::value)
 	{
-		out << entry << std::endl;
+		if(entity.template assigned<Color>()) return rgbOf(entity.template get<Color>());
 	}
-
-	return out;
+	return Vector3D(0.5, 0.5, 0.5);
 }
 
+// Smallest box holding every particle
 template<typename P>
-struct correct_particle
+struct bound_particles
 {
-	template<typename ParticleTuple, typename Time>
-	static void call(ParticleTuple & particleVectorTuple, const Time & time)
+	template<typename T>
+	static void call(const T & particleVectorTuple, Vector3D & lower, Vector3D & upper, bool & empty)
 	{
-		for(auto& particle : std::get<vector<P>>(particleVectorTuple))
+		for(const auto& particle : std::get< vector<P> >(particleVectorTuple))
 		{
-			auto acceleration = particle.getResultingForce() / particle.template get<Mass>();
-			auto angularAcceleration = particle.getResultingTorque() / particle.template get<MomentOfInertia>();
-
-			auto correctedPosition = Interaction<>::gearCorrector(
-					particle.getPositionMatrix(),
-					acceleration,
-					2,
-					particle.getTaylorOrder(),
-					time.getTimeStep()
-				);
-			particle.setPositionMatrix(correctedPosition);
-
-			if constexpr(is_spherical<P>::value)
+			double radius = 0.0;
+			if constexpr(has_property<P, Radius>::value)
 			{
-				auto orientation = particle.getOrientation();
-				auto orientationMatrix = particle.getOrientationMatrix();
-
-				// std::cout << "Particle name: " << particle.getName() << "-----------------" << std::endl; // DEBUG
-
-				// std::cout << "Orientation Matrix:\n" << orientationMatrix << std::endl; // DEBUG
-
-				orientationMatrix.erase(orientationMatrix.begin());
-
-				// std::cout << "Orientation Matrix after erasing orientation:\n" << orientationMatrix << std::endl; // DEBUG
-				// std::cout << "Angular acceleration: " << angularAcceleration << std::endl; // DEBUG
-
-
-				auto correctedOrientation = Interaction<>::gearCorrector(
-						orientationMatrix,
-						angularAcceleration,
-						1,
-						particle.getTaylorOrder()-1,
-						time.getTimeStep()
-					);
-
-				// std::cout << "Corrected Orientation Matrix:\n" << correctedOrientation << std::endl; // DEBUG
-
-				correctedOrientation.insert(correctedOrientation.begin(), orientation);
-
-				// std::cout << "Corrected Orientation Matrix after inserting orientation:\n" << correctedOrientation << std::endl; // DEBUG
-
-				particle.setOrientationMatrix(correctedOrientation);
+				if(particle.template assigned<Radius>()) radius = particle.template get<Radius>();
 			}
-			else
+
+			for(std::size_t i = 0; i < 3; ++i)
 			{
-				vector<Vector3D> correctedOrientation = Interaction<>::gearCorrector(
-						particle.getOrientationMatrix(),
-						angularAcceleration,
-						2,
-						particle.getTaylorOrder(),
-						time.getTimeStep()
-					);
-				particle.setOrientationMatrix(correctedOrientation);
+				const double position = particle.getPosition()[i];
+				lower[i] = empty ? position - radius : std::min(lower[i], position - radius);
+				upper[i] = empty ? position + radius : std::max(upper[i], position + radius);
 			}
+			empty = false;
 		}
 	}
 };
 
-template<typename P>
-struct initialize_particle
-{
-	template<typename ParticleTuple>
-	static void call(ParticleTuple & particleVectorTuple)
-	{
-		for(auto& particle : std::get<vector<P>>(particleVectorTuple))
-		{
-			particle.setBodyForce( nullVector3D() );
-			particle.setContactForce( nullVector3D() );
-			particle.setResultingTorque( nullVector3D() );
-		}
-	}
-};
-
-template<typename InteractionTriplet>
-struct interact_particle_particle
+// Planes are infinite: each one is drawn as a square centered where the particles' box center
+// projects onto it, with the box's half diagonal as half its side
+template<typename B>
+struct append_plane_polygons
 {
-	template<typename ParticleVectorTuple, typename Time>
-	static void call(ParticleVectorTuple & particleVectorTuple, const Time & time, const std::set< std::string > & interactionsToUse)
+	template<typename T>
+	static void call(const T & boundaryVectorTuple, const Vector3D & center, const double halfSide, std::vector<double> & points, std::vector< std::vector<std::size_t> > & polygons, std::vector<vtk::DataArray> & cellData)
 	{
-		using InteractionType = typename mp::get<0, InteractionTriplet>::type;
-		using EntityType = typename mp::get<1, InteractionTriplet>::type;
-		using NeighborType = typename mp::get<2, InteractionTriplet>::type;
-
-		if(interactionsToUse.count(NamedType<InteractionType>::name) > 0) // check at runtime that this interaction should be used
+		if constexpr(is_plane<B>::value)
 		{
-			if(std::is_same<EntityType, NeighborType>::value)
-			{
-				for(auto&& entity_it = std::get<vector<EntityType>>(particleVectorTuple).begin();
-					entity_it != std::get<vector<EntityType>>(particleVectorTuple).end();
-					++entity_it)
-				{
-					for(auto&& neighbor_it = std::next(entity_it);
-						neighbor_it != std::get<vector<EntityType>>(particleVectorTuple).end();
-						++neighbor_it)
-					{
-						InteractionType::calculate(*entity_it, *neighbor_it, time);
-					}
-				}
-			}
-			else
+			for(const auto& plane : std::get< vector<B> >(boundaryVectorTuple))
 			{
-				for(auto& entity : std::get<vector<EntityType>>(particleVectorTuple))
+				const Vector3D normal = plane.getNormalVersor();
+				const Vector3D planeCenter = center - dot(center - plane.getOrigin(), normal) * normal;
+				const Vector3D u = cross(normal, std::abs(normal.x()) < 0.9 ? Vector3D(1.0, 0.0, 0.0) : Vector3D(0.0, 1.0, 0.0)).normalized() * halfSide;
+				const Vector3D v = cross(normal, u);
+
+				std::vector<std::size_t> polygon;
+				for(const Vector3D & corner : {planeCenter + u + v, planeCenter - u + v, planeCenter - u - v, planeCenter + u - v})
 				{
-					for(auto& neighbor : std::get<vector<NeighborType>>(particleVectorTuple))
-					{
-						InteractionType::calculate(entity, neighbor, time);
-					}
+					polygon.push_back(points.size() / 3);
+					append_vector(points, corner);
 				}
+				polygons.push_back(std::move(polygon));
+
+				append_vector(cellData[0].values, normal);
+				append_vector(cellData[1].values, entity_rgb(plane));
 			}
 		}
 	}
 };
 
-template<typename InteractionTriplet>
-struct interact_particle_boundary
+// Lists the static properties of every particle, checking that they have the derivatives outputFields ask for
+template<typename P>
+struct describe_particles
 {
-	template<typename ParticleVectorTuple, typename BoundaryVectorTuple, typename Time>
-	static void call(ParticleVectorTuple & particleVectorTuple, BoundaryVectorTuple & boundaryVectorTuple, const Time & time, const std::set< std::string > & interactionsToUse)
+	template<typename T>
+	static void call(const T & particleVectorTuple, json & description, const std::vector<OutputField> & outputFields)
 	{
-		using InteractionType = typename mp::get<0, InteractionTriplet>::type;
-		using EntityType = typename mp::get<1, InteractionTriplet>::type;
-		using NeighborType = typename mp::get<2, InteractionTriplet>::type;
-
-		if(interactionsToUse.count(NamedType<InteractionType>::name) > 0)
+		for(const auto& particle : std::get< vector<P> >(particleVectorTuple))
 		{
-			for(auto& entity : std::get<vector<EntityType>>(particleVectorTuple))
+			for(const OutputField & field : outputFields)
 			{
-				for(auto& neighbor : std::get<vector<NeighborType>>(boundaryVectorTuple))
-				{
-					InteractionType::calculate(entity, neighbor, time);
-				}
+				field.getComponents(particle.getTaylorOrder());
 			}
+
+			description[particle.getName()] = json{
+				{"particleType", NamedType<P>::name},
+				{"particle", particle_properties(particle)}
+			};
 		}
 	}
 };
@@ -769,118 +870,874 @@ struct interact_particle_boundary
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
->::exportTime(const bool first)
+	SeekerList<SeekerTypes...>
+>::openFiles()
 {
-	// json fileContent;
-
-	// path filepath = fileTree["output"]["main"] / path("timeVector.json");
-	// mainFileMap["timeVector"]->seekg(0); // rewinds the file
-	// *mainFileMap["timeVector"] >> fileContent;
-	// mainFileMap["timeVector"]->close();
+	const bool jsonLines = (this->jsonLayout == "Lines");
+	this->jsonEntriesWritten = false;
 
-	// mainFileMap["timeVector"]->open(filepath.string(), std::ios::in | std::ios::out | std::ios::trunc);
-	// *mainFileMap["timeVector"] << merge(std::move(fileContent), timeJsonVector).dump(4) << std::flush;
-
-	if(first) *mainFileMap["timeVector"] << '\n' << std::flush;
-	else if(not timeJsonVector.empty()) *mainFileMap["timeVector"] << ",\n" << std::flush;
+	path timeVectorOutputFilePath = fileTree["output"]["main"] / path("timeVector" + detail::json_extension(jsonLines));
+	mainFileMap["timeVector"] = make_unique<std::fstream>(timeVectorOutputFilePath.string(), std::ios::in | std::ios::out | std::ios::trunc);
+	// *mainFileMap["timeVector"] << json().dump();
+	if(not jsonLines) *mainFileMap["timeVector"] << "[" << std::flush;
+	mainIndexMap["timeVector"].open(timeindex::indexPathOf(timeVectorOutputFilePath), json{ {"Stream", timeVectorOutputFilePath.filename()} });
 
-	bool firstVectorElement = true;
-	for(auto&& j : timeJsonVector)
+	if(this->keepInteractionStatistics)
 	{
-		if(firstVectorElement) *mainFileMap["timeVector"] << j.dump(4) << std::flush;
-		else *mainFileMap["timeVector"] << ",\n" << j.dump(4) << std::flush;
-		firstVectorElement = false;
+		path statisticsOutputFilePath = fileTree["output"]["main"] / path("interactionStatistics" + detail::json_extension(jsonLines));
+		fileTree["output"]["interactionStatistics"] = statisticsOutputFilePath;
+		interactionStatisticsFile.open(statisticsOutputFilePath.string(), std::ios::in | std::ios::out | std::ios::trunc);
+		if(not jsonLines) interactionStatisticsFile << "[" << std::flush;
+		interactionStatisticsIndex.open(timeindex::indexPathOf(statisticsOutputFilePath), json{ {"Stream", statisticsOutputFilePath.filename()} });
 	}
 
-	timeJsonVector.clear();
-}
-
-template<
-	typename ... ParticleTypes,
-	typename ... BoundaryTypes,
-	typename ... InteractionTypes
->
-void Simulator<
-	ParticleList<ParticleTypes...>,
-	BoundaryList<BoundaryTypes...>,
-	InteractionList<InteractionTypes...>,
-	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
->::exportParticles(const bool first)
-{
-	for(auto&& it = particleJsonMap.begin(); it != particleJsonMap.end(); ++it)
+	// With selected output fields, the static part of the particles is written once, here
+	if(not this->outputFields.empty())
 	{
-		// json fileContent;
+		json particleProperties = json::object();
+		mp::visit<ParticleList, detail::describe_particles>::call_same(particles, particleProperties, outputFields);
+
+		path particlePropertiesFilePath = fileTree["output"]["main"] / path("particleProperties.json");
+		std::ofstream(particlePropertiesFilePath.string()) << particleProperties.dump(4);
+	}
 
-		// path filepath = fileTree["output"]["particle"][it->first].get<path>();
-		// particleFileMap[it->first]->seekg(0); // rewinds the file
-		// *particleFileMap[it->first] >> fileContent;
-		// particleFileMap[it->first]->close();
+	const std::vector<OutputField> & fields = this->outputFields.empty() ? detail::default_output_fields() : this->outputFields;
+	if(this->outputFormat == "Binary")
+	{
+		mp::visit<ParticleList, detail::open_particle_trajectory>::call_same(particles, fileTree, particleTrajectoryMap, fields);
+	}
+	else if(this->outputFormat == "Frames")
+	{
+		std::vector<FrameEntity> entities;
+		mp::visit<ParticleList, detail::describe_particle_frames>::call_same(particles, entities, fields);
 
-		// particleFileMap[it->first]->open(filepath.string(), std::ios::in | std::ios::out | std::ios::trunc);
-		// *particleFileMap[it->first] << merge(std::move(fileContent), it->second).dump(4) << std::flush;
+		path framesOutputPath = fileTree["output"]["particleDir"].get<path>() / path("frames.bin");
+		fileTree["output"]["frames"] = framesOutputPath;
+		particleFrameWriter.open(framesOutputPath, entities, json{ {"OutputFields", fields} });
+	}
+	else if(this->outputFormat == "Compressed")
+	{
+		std::vector<FrameEntity> entities;
+		mp::visit<ParticleList, detail::describe_particle_frames>::call_same(particles, entities, fields);
 
-		if(first) *particleFileMap[it->first] << '\n' << std::flush;
-		else if(not it->second.empty())	*particleFileMap[it->first] << ",\n" << std::flush;
+		path framesOutputPath = fileTree["output"]["particleDir"].get<path>() / path("frames.delta");
+		fileTree["output"]["frames"] = framesOutputPath;
+		particleCompressedFrameWriter.open(framesOutputPath, entities, this->keyframeInterval, json{ {"OutputFields", fields} });
+	}
+	else
+	{
+		mp::visit<ParticleList, detail::open_particle_file>::call_same(particles, fileTree, particleFileMap, particleIndexMap, jsonLines);
+	}
+	mp::visit<BoundaryList, detail::open_boundary_file>::call_same(boundaries, fileTree, boundaryFileMap, boundaryIndexMap, jsonLines);
 
-		bool firstVectorElement = true;
-		for(auto&& j : it->second)
+	if(this->vtkOutput)
+	{
+		path vtkFolder = fileTree["output"]["main"] / path("vtk");
+		filesystem::create_directories(vtkFolder);
+		fileTree["output"]["vtk"] = vtkFolder;
+		particleVtkSeries.open(vtkFolder / path("particles.pvd"));
+
+		Vector3D lower;
+		Vector3D upper;
+		bool empty = true;
+		mp::visit<ParticleList, detail::bound_particles>::call_same(particles, lower, upper, empty);
+
+		const Vector3D center = 0.5 * (lower + upper);
+		const double halfSide = empty ? 1.0 : std::max(0.5 * distance(lower, upper), 1e-12);
+
+		std::vector<double> points;
+		std::vector< std::vector<std::size_t> > polygons;
+		std::vector<vtk::DataArray> cellData{ {"Normal", 3}, {"Color", 3} };
+		mp::visit<BoundaryList, detail::append_plane_polygons>::call_same(boundaries, center, halfSide, points, polygons, cellData);
+		if(not polygons.empty())
 		{
-			if(firstVectorElement) *particleFileMap[it->first] << j.dump(4) << std::flush;
-			else *particleFileMap[it->first] << ",\n" << j.dump(4) << std::flush;
-			firstVectorElement = false;
+			vtk::writePolygons(vtkFolder / path("planes.vtu"), points, polygons, cellData);
 		}
-
-		it->second.clear();
 	}
 }
 
-template<
-	typename ... ParticleTypes,
-	typename ... BoundaryTypes,
-	typename ... InteractionTypes
->
-void Simulator<
-	ParticleList<ParticleTypes...>,
-	BoundaryList<BoundaryTypes...>,
-	InteractionList<InteractionTypes...>,
-	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
->::exportBoundaries(const bool first)
+namespace detail {
+
+// A particle is written to output frames as its position and orientation Taylor matrices,
+// followed by its body force, contact force and resulting torque: everything else in
+// its JSON output is either constant or computed from these.
+template<typename P>
+void append_particle_state(const P & particle, OutputBuffer::Frame & frame)
 {
-	for(auto&& it = boundaryJsonMap.begin(); it != boundaryJsonMap.end(); ++it)
+	auto append = [&frame](const Vector3D & vector)
 	{
-		// json fileContent;
+		frame.push_back(vector.x());
+		frame.push_back(vector.y());
+		frame.push_back(vector.z());
+	};
 
-		// path filepath = fileTree["output"]["boundary"][it->first].get<path>();
-		// boundaryFileMap[it->first]->seekg(0); // rewinds the file
-		// *boundaryFileMap[it->first] >> fileContent;
-		// boundaryFileMap[it->first]->close();
+	for(auto&& row : particle.getPositionMatrix()) append(row);
+	for(auto&& row : particle.getOrientationMatrix()) append(row);
+	append(particle.getBodyForce());
+	append(particle.getContactForce());
+	append(particle.getResultingTorque());
+}
 
-		// boundaryFileMap[it->first]->open(filepath.string(), std::ios::in | std::ios::out | std::ios::trunc);
-		// *boundaryFileMap[it->first] << merge(std::move(fileContent), it->second).dump(4) << std::flush;
+// Restores the state written by append_particle_state, returning where the next particle's state begins
+template<typename P>
+const double * read_particle_state(P & particle, const double * state)
+{
+	auto read = [&state]()
+	{
+		const Vector3D vector(state[0], state[1], state[2]);
+		state += 3;
+		return vector;
+	};
 
-		if(first) *boundaryFileMap[it->first] << '\n' << std::flush;
-		else if(not it->second.empty()) *boundaryFileMap[it->first] << ",\n" << std::flush;
-			
-		bool firstVectorElement = true;
-		for(auto&& j : it->second)
-		{
-			if(firstVectorElement) *boundaryFileMap[it->first] << j.dump(4) << std::flush;
-			else *boundaryFileMap[it->first] << ",\n" << j.dump(4) << std::flush;
-			firstVectorElement = false;
-		}
+	vector<Vector3D> matrix(particle.getTaylorOrder() + 1);
 
-		it->second.clear();
-	}
+	for(auto& row : matrix) row = read();
+	particle.setPositionMatrix(matrix);
+	for(auto& row : matrix) row = read();
+	particle.setOrientationMatrix(matrix);
+
+	particle.setBodyForce(read());
+	particle.setContactForce(read());
+	particle.setResultingTorque(read());
+
+	return state;
+}
+
+template<typename P>
+struct write_particle_state
+{
+	template<typename ParticleTuple>
+	static void call(const ParticleTuple & particleVectorTuple, OutputBuffer::Frame & frame)
+	{
+		for(auto&& particle : std::get< vector<P> >(particleVectorTuple))
+		{
+			append_particle_state(particle, frame);
+		}
+	}
+};
+
+template<typename P>
+struct restore_particle_state
+{
+	template<typename ParticleTuple>
+	static void call(ParticleTuple & particleVectorTuple, const double *& state)
+	{
+		for(auto& particle : std::get< vector<P> >(particleVectorTuple))
+		{
+			state = read_particle_state(particle, state);
+		}
+	}
+};
+
+// Lists the particles in the order write_particle_state writes their states
+template<typename P>
+struct list_particles
+{
+	template<typename ParticleTuple>
+	static void call(const ParticleTuple & particleVectorTuple, json & list)
+	{
+		for(auto&& particle : std::get< vector<P> >(particleVectorTuple))
+		{
+			list.push_back( json{
+				{"Name", particle.getName()},
+				{"Type", NamedType<P>::name},
+				{"TaylorOrder", particle.getTaylorOrder()}
+			} );
+		}
+	}
+};
+
+template<typename P>
+struct export_particles_to_json
+{
+	template<typename ParticleTuple>
+	static void call(ParticleTuple & particleVectorTuple, const double * & state, const std::size_t timeIndex, const double time, const std::vector<OutputField> & outputFields, std::map<string, unique_ptr<std::fstream>>& particleFileMap, std::map<string, TimeIndexWriter>& particleIndexMap, const bool firstEntry, const bool jsonLines)
+	{
+		for(auto& particle : std::get< vector<P> >(particleVectorTuple))
+		{
+			state = read_particle_state(particle, state);
+
+			json j;
+			if(outputFields.empty())
+			{
+				j = json{
+					{trajectory::timeIndexField, timeIndex},
+					{"particleType", NamedType<P>::name},
+					{"particle", particle}
+				};
+			}
+			else
+			{
+				json fields;
+				for(const OutputField & field : outputFields)
+				{
+					fields[field.getName()] = output_field_json(field, particle);
+				}
+				j = json{
+					{trajectory::timeIndexField, timeIndex},
+					{"particle", fields}
+				};
+			}
+			write_json_entry(*particleFileMap[particle.getName()], particleIndexMap[particle.getName()], timeIndex, time, j, firstEntry, jsonLines);
+		}
+	}
+};
+
+template<typename P>
+struct export_particles_to_trajectory
+{
+	template<typename ParticleTuple>
+	static void call(ParticleTuple & particleVectorTuple, const double * & state, const std::size_t timeIndex, const double time, const std::vector<OutputField> & outputFields, std::map<string, TrajectoryWriter>& particleTrajectoryMap, std::vector<double> & values)
+	{
+		for(auto& particle : std::get< vector<P> >(particleVectorTuple))
+		{
+			state = read_particle_state(particle, state);
+
+			values.clear();
+			for(const OutputField & field : outputFields)
+			{
+				append_output_field(field, particle, values);
+			}
+
+			particleTrajectoryMap[particle.getName()].append(timeIndex, time, values.data());
+		}
+	}
+};
+
+template<typename P>
+struct append_particles_to_vtk
+{
+	template<typename ParticleTuple>
+	static void call(ParticleTuple & particleVectorTuple, const double * & state, std::vector<double> & points, std::vector<vtk::DataArray> & pointData)
+	{
+		for(auto& particle : std::get< vector<P> >(particleVectorTuple))
+		{
+			state = read_particle_state(particle, state);
+
+			double radius = 0.0;
+			if constexpr(has_property<P, Radius>::value)
+			{
+				if(particle.template assigned<Radius>()) radius = particle.template get<Radius>();
+			}
+
+			append_vector(points, particle.getPosition());
+			pointData[0].values.push_back(radius);
+			append_vector(pointData[1].values, particle.getVelocity());
+			append_vector(pointData[2].values, particle.getAngularVelocity());
+			append_vector(pointData[3].values, particle.getResultingForce());
+			append_vector(pointData[4].values, entity_rgb(particle));
+		}
+	}
+};
+
+template<typename P>
+struct append_particles_to_frame
+{
+	template<typename ParticleTuple>
+	static void call(ParticleTuple & particleVectorTuple, const double * & state, const std::vector<OutputField> & outputFields, std::vector<double> & values)
+	{
+		for(auto& particle : std::get< vector<P> >(particleVectorTuple))
+		{
+			state = read_particle_state(particle, state);
+
+			for(const OutputField & field : outputFields)
+			{
+				append_output_field(field, particle, values);
+			}
+		}
+	}
+};
+
+template<typename B>
+struct export_boundaries_to_json
+{
+	template<typename BoundaryTuple>
+	static void call(const BoundaryTuple & boundaryVectorTuple, const std::size_t timeIndex, const double time, std::map<string, unique_ptr<std::fstream>>& boundaryFileMap, std::map<string, TimeIndexWriter>& boundaryIndexMap, const bool firstEntry, const bool jsonLines)
+	{
+		for(auto&& boundary : std::get< vector<B> >(boundaryVectorTuple))
+		{
+			json j{
+				{trajectory::timeIndexField, timeIndex},
+				{"boundaryType", NamedType<B>::name},
+				{"boundary", boundary}
+			};
+			write_json_entry(*boundaryFileMap[boundary.getName()], boundaryIndexMap[boundary.getName()], timeIndex, time, j, firstEntry, jsonLines);
+		}
+	}
+};
+
+// Particles and boundaries share a single sequence of handles, so that every entity's handle is unique
+template<typename E>
+struct assign_handles
+{
+	template<typename EntityVectorTuple>
+	static void call(EntityVectorTuple & entityVectorTuple, int & nextHandle)
+	{
+		for(auto& entity : std::get<vector<E>>(entityVectorTuple))
+		{
+			entity.setHandle(nextHandle++);
+		}
+	}
+};
+
+template<typename P>
+struct bind_particle_store
+{
+	template<typename ParticleTuple, typename ParticleStoreTuple>
+	static void call(ParticleTuple & particleVectorTuple, ParticleStoreTuple & particleStoreTuple)
+	{
+		std::get<ParticleStore<P>>(particleStoreTuple).bind( std::get<vector<P>>(particleVectorTuple) );
+	}
+};
+
+template<typename P>
+struct predict_particle
+{
+	template<typename ParticleStoreTuple, typename Time>
+	static void call(ParticleStoreTuple & particleStoreTuple, const Time & time, ThreadPool & threadPool)
+	{
+		auto& store = std::get<ParticleStore<P>>(particleStoreTuple);
+		threadPool.parallel_for(store.size(), [&](const std::size_t begin, const std::size_t end)
+		{
+			store.predict(time.getCoefficients(), begin, end);
+		});
+	}
+};
+
+template<typename B>
+struct update_boundary
+{
+	template<typename BoundaryVectorTuple, typename Time>
+	static void call(BoundaryVectorTuple & boundaryVectorTuple, const Time & time)
+	{
+		for(auto& boundary : std::get<vector<B>>(boundaryVectorTuple))
+		{
+			boundary.update(time);
+		}
+	}
+};
+
+template<typename Ofstream>
+Ofstream& operator<<(Ofstream& out, const vector<Vector3D> & v)// DEBUG
+{
+	for(auto&& entry : v)
+	{
+		out << entry << std::endl;
+	}
+
+	return out;
+}
+
+template<typename P>
+struct correct_particle
+{
+	template<typename ParticleStoreTuple, typename Time>
+	static void call(ParticleStoreTuple & particleStoreTuple, const Time & time, ThreadPool & threadPool)
+	{
+		auto& store = std::get<ParticleStore<P>>(particleStoreTuple);
+		threadPool.parallel_for(store.size(), [&](const std::size_t begin, const std::size_t end)
+		{
+			store.correct(time.getCoefficients(), begin, end);
+		});
+	}
+};
+
+template<typename P>
+struct initialize_particle
+{
+	template<typename ParticleStoreTuple>
+	static void call(ParticleStoreTuple & particleStoreTuple, ThreadPool & threadPool)
+	{
+		auto& store = std::get<ParticleStore<P>>(particleStoreTuple);
+		threadPool.parallel_for(store.size(), [&](const std::size_t begin, const std::size_t end)
+		{
+			store.resetForces(begin, end);
+		});
+	}
+};
+
+template<typename P>
+struct track_particle_store
+{
+	template<typename ParticleStoreTuple>
+	static void call(ParticleStoreTuple & particleStoreTuple, PairEvaluator & pairEvaluator)
+	{
+		pairEvaluator.track( std::get<ParticleStore<P>>(particleStoreTuple) );
+	}
+};
+
+template<typename P>
+struct count_particles
+{
+	template<typename ParticleVectorTuple>
+	static void call(const ParticleVectorTuple & particleVectorTuple, InteractionStatistics & statistics)
+	{
+		statistics.setNumberOfParticles(NamedType<P>::name, std::get<vector<P>>(particleVectorTuple).size());
+	}
+};
+
+template<typename S>
+struct update_seeker
+{
+	template<typename SeekerTuple, typename ParticleVectorTuple>
+	static void call(SeekerTuple & seekerTuple, const ParticleVectorTuple & particleVectorTuple, const string & seekerToUse)
+	{
+		if(NamedType<S>::name == seekerToUse)
+		{
+			std::get<S>(seekerTuple).update(particleVectorTuple);
+		}
+	}
+};
+
+// Calls InteractionType::calculate, passing the interaction's contact history if it keeps one
+template<typename InteractionType, typename EntityType, typename NeighborType, typename Time, typename ContactHistoryTuple>
+void calculate_interaction(EntityType & entity, NeighborType & neighbor, const Time & time, ContactHistoryTuple & contactHistoryTuple)
+{
+	if constexpr(has_contact_history<InteractionType>::value)
+	{
+		InteractionType::calculate(entity, neighbor, time, std::get< InteractionContactHistory<InteractionType> >(contactHistoryTuple));
+	}
+	else
+	{
+		InteractionType::calculate(entity, neighbor, time);
+	}
+}
+
+// Throws unless entity has every property listed by interaction_properties<InteractionType> assigned,
+// among those that EntityType has
+template<typename InteractionType, typename EntityType>
+void check_interaction_properties(const EntityType & entity)
+{
+	using Properties = typename interaction_properties<InteractionType>::type;
+
+	mp::for_each< mp::provide_indices<Properties> >(
+	[&](auto Index)
+	{
+		using P = typename mp::get<Index, Properties>::type;
+		if constexpr(has_property<EntityType, P>::value)
+		{
+			if(not entity.template assigned<P>())
+			{
+				throw std::runtime_error(entity.getName() + " has no " + NamedType<P>::name + ", which " + NamedType<InteractionType>::name + " needs");
+			}
+		}
+	});
+}
+
+template<typename InteractionTriplet>
+struct check_triplet_properties
+{
+	template<typename EntityVectorTuple, typename NeighborVectorTuple>
+	static void call(const EntityVectorTuple & entityVectorTuple, const NeighborVectorTuple & neighborVectorTuple, const std::set< std::string > & interactionsToUse)
+	{
+		using InteractionType = typename mp::get<0, InteractionTriplet>::type;
+		using EntityType = typename mp::get<1, InteractionTriplet>::type;
+		using NeighborType = typename mp::get<2, InteractionTriplet>::type;
+
+		if(interactionsToUse.count(NamedType<InteractionType>::name) > 0)
+		{
+			for(auto&& entity : std::get< vector<EntityType> >(entityVectorTuple))
+			{
+				check_interaction_properties<InteractionType>(entity);
+			}
+			for(auto&& neighbor : std::get< vector<NeighborType> >(neighborVectorTuple))
+			{
+				check_interaction_properties<InteractionType>(neighbor);
+			}
+		}
+	}
+};
+
+// Counts a pair handed to InteractionType in the interaction statistics. The interaction tests
+// contact again by itself, so this overlap() is only computed while statistics are kept.
+template<typename InteractionType, typename EntityType, typename NeighborType>
+void count_pair(InteractionStatistics::Triplet & triplet, const unsigned thread, const EntityType & entity, const NeighborType & neighbor, const InteractionStatistics::index_pair & pair)
+{
+	triplet.countCandidate(thread);
+	if constexpr(is_contact_interaction<InteractionType>::value)
+	{
+		if(overlap(entity, neighbor) > 0.0) triplet.countTouching(thread, pair);
+	}
+}
+
+// Name of an interaction triplet's phase, as the profiler joins it. It lives as long as the
+// program, so that tracers can keep pointing to it.
+template<typename InteractionTriplet>
+const char * interaction_phase_name()
+{
+	static const string name = "Interaction/"
+		+ NamedType<typename mp::get<0, InteractionTriplet>::type>::name + "/"
+		+ NamedType<typename mp::get<1, InteractionTriplet>::type>::name + "/"
+		+ NamedType<typename mp::get<2, InteractionTriplet>::type>::name;
+	return name.c_str();
+}
+
+template<typename InteractionTriplet>
+struct interact_particle_particle
+{
+	template<typename ParticleVectorTuple, typename Time, typename SeekerTuple, typename ContactHistoryTuple>
+	static void call(ParticleVectorTuple & particleVectorTuple, const Time & time, const std::set< std::string > & interactionsToUse, const SeekerTuple & seekerTuple, const string & seekerToUse, ContactHistoryTuple & contactHistoryTuple, PairEvaluator & pairEvaluator, Profiler & profiler, Tracer & tracer, InteractionStatistics * statistics)
+	{
+		using InteractionType = typename mp::get<0, InteractionTriplet>::type;
+		using EntityType = typename mp::get<1, InteractionTriplet>::type;
+		using NeighborType = typename mp::get<2, InteractionTriplet>::type;
+
+		if(interactionsToUse.count(NamedType<InteractionType>::name) > 0) // check at runtime that this interaction should be used
+		{
+			auto phase = profiler.time("Interaction", NamedType<InteractionType>::name, NamedType<EntityType>::name, NamedType<NeighborType>::name);
+			auto event = tracer.scope( interaction_phase_name<InteractionTriplet>() );
+
+			auto& entities = std::get<vector<EntityType>>(particleVectorTuple);
+			auto& neighbors = std::get<vector<NeighborType>>(particleVectorTuple);
+
+			// Pairs are only counted when statistics are kept
+			InteractionStatistics::Triplet * triplet = statistics ? &statistics->triplet(NamedType<InteractionType>::name, NamedType<EntityType>::name, NamedType<NeighborType>::name, true) : nullptr;
+
+			auto calculate = [&](EntityType & entity, NeighborType & neighbor, const unsigned thread)
+			{
+				if(triplet) count_pair<InteractionType>(*triplet, thread, entity, neighbor, {&entity - entities.data(), &neighbor - neighbors.data()});
+				calculate_interaction<InteractionType>(entity, neighbor, time, contactHistoryTuple);
+			};
+
+			auto forEachCandidate = [&](auto && function)
+			{
+				if constexpr(is_contact_interaction<InteractionType>::value)
+				{
+					mp::for_each< mp::provide_indices<SeekerTuple> >(
+					[&](auto Index)
+					{
+						using S = typename mp::get<Index, SeekerTuple>::type;
+						if(NamedType<S>::name == seekerToUse)
+						{
+							std::get<S>(seekerTuple).template for_each_candidate<EntityType, NeighborType>(particleVectorTuple, function);
+						}
+					});
+				}
+				else
+				{
+					// Non-contact interactions act between every pair of particles
+					BlindSeeker().template for_each_candidate<EntityType, NeighborType>(particleVectorTuple, function);
+				}
+			};
+
+			// Contact histories cannot grow from several threads at once, so interactions keeping one are evaluated serially
+			if(pairEvaluator.isSerial() or has_contact_history<InteractionType>::value)
+			{
+				forEachCandidate([&](EntityType & entity, NeighborType & neighbor)
+				{
+					calculate(entity, neighbor, 0);
+				});
+			}
+			else
+			{
+				auto& pairs = pairEvaluator.pairs();
+				pairs.clear();
+				forEachCandidate([&](EntityType & entity, NeighborType & neighbor)
+				{
+					pairs.emplace_back(&entity - entities.data(), &neighbor - neighbors.data());
+				});
+
+				pairEvaluator.evaluate(pairs.size(), [&](const std::size_t pair, const unsigned thread)
+				{
+					calculate(entities[pairs[pair].first], neighbors[pairs[pair].second], thread);
+				});
+			}
+		}
+	}
+};
+
+template<typename InteractionTriplet>
+struct interact_particle_boundary
+{
+	template<typename ParticleVectorTuple, typename BoundaryVectorTuple, typename Time, typename ContactHistoryTuple>
+	static void call(ParticleVectorTuple & particleVectorTuple, BoundaryVectorTuple & boundaryVectorTuple, const Time & time, const std::set< std::string > & interactionsToUse, ContactHistoryTuple & contactHistoryTuple, PairEvaluator & pairEvaluator, Profiler & profiler, Tracer & tracer, InteractionStatistics * statistics)
+	{
+		using InteractionType = typename mp::get<0, InteractionTriplet>::type;
+		using EntityType = typename mp::get<1, InteractionTriplet>::type;
+		using NeighborType = typename mp::get<2, InteractionTriplet>::type;
+
+		if(interactionsToUse.count(NamedType<InteractionType>::name) > 0)
+		{
+			auto phase = profiler.time("Interaction", NamedType<InteractionType>::name, NamedType<EntityType>::name, NamedType<NeighborType>::name);
+			auto event = tracer.scope( interaction_phase_name<InteractionTriplet>() );
+
+			auto& entities = std::get<vector<EntityType>>(particleVectorTuple);
+			auto& neighbors = std::get<vector<NeighborType>>(boundaryVectorTuple);
+
+			InteractionStatistics::Triplet * triplet = statistics ? &statistics->triplet(NamedType<InteractionType>::name, NamedType<EntityType>::name, NamedType<NeighborType>::name, false) : nullptr;
+
+			auto calculate = [&](const std::size_t entity, const std::size_t neighbor, const unsigned thread)
+			{
+				if(triplet) count_pair<InteractionType>(*triplet, thread, entities[entity], neighbors[neighbor], {entity, neighbor});
+				calculate_interaction<InteractionType>(entities[entity], neighbors[neighbor], time, contactHistoryTuple);
+			};
+
+			if(pairEvaluator.isSerial() or has_contact_history<InteractionType>::value)
+			{
+				for(std::size_t entity = 0; entity < entities.size(); ++entity)
+				{
+					for(std::size_t neighbor = 0; neighbor < neighbors.size(); ++neighbor)
+					{
+						calculate(entity, neighbor, 0);
+					}
+				}
+			}
+			else
+			{
+				// Pairs are numbered entity by entity, in the same order as the serial loops
+				pairEvaluator.evaluate(entities.size() * neighbors.size(), [&](const std::size_t pair, const unsigned thread)
+				{
+					calculate(pair / neighbors.size(), pair % neighbors.size(), thread);
+				});
+			}
+		}
+	}
+};
+
+template<typename I>
+struct age_contact_history
+{
+	template<typename ContactHistoryTuple>
+	static void call(ContactHistoryTuple & contactHistoryTuple)
+	{
+		std::get< InteractionContactHistory<I> >(contactHistoryTuple).age();
+	}
+};
+
+// A contact history is checkpointed as its entries, in no particular order
+template<typename I>
+struct write_contact_history
+{
+	template<typename ContactHistoryTuple>
+	static void call(const ContactHistoryTuple & contactHistoryTuple, CheckpointWriter & checkpoint)
+	{
+		if constexpr(has_contact_history<I>::value)
+		{
+			std::vector< std::pair<handle_pair, typename I::contact_history_type> > entries;
+			std::get< InteractionContactHistory<I> >(contactHistoryTuple).for_each(
+				[&entries](const handle_pair & pair, const typename I::contact_history_type & value)
+				{
+					entries.emplace_back(pair, value);
+				});
+			checkpoint.write(entries);
+		}
+	}
+};
+
+template<typename I>
+struct read_contact_history
+{
+	template<typename ContactHistoryTuple>
+	static void call(ContactHistoryTuple & contactHistoryTuple, CheckpointReader & checkpoint)
+	{
+		if constexpr(has_contact_history<I>::value)
+		{
+			std::vector< std::pair<handle_pair, typename I::contact_history_type> > entries;
+			checkpoint.read(entries);
+
+			auto& history = std::get< InteractionContactHistory<I> >(contactHistoryTuple);
+			history.clear();
+			for(auto&& entry : entries)
+			{
+				history.restore(entry.first, entry.second);
+			}
+		}
+	}
+};
+
+} // detail
+
+template<
+	typename ... ParticleTypes,
+	typename ... BoundaryTypes,
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
+>
+void Simulator<
+	ParticleList<ParticleTypes...>,
+	BoundaryList<BoundaryTypes...>,
+	InteractionList<InteractionTypes...>,
+	IntegratorList<GearIntegrator>,
+	SeekerList<SeekerTypes...>
+>::exportTime(const bool first)
+{
+	// json fileContent;
+
+	// path filepath = fileTree["output"]["main"] / path("timeVector.json");
+	// mainFileMap["timeVector"]->seekg(0); // rewinds the file
+	// *mainFileMap["timeVector"] >> fileContent;
+	// mainFileMap["timeVector"]->close();
+
+	// mainFileMap["timeVector"]->open(filepath.string(), std::ios::in | std::ios::out | std::ios::trunc);
+	// *mainFileMap["timeVector"] << merge(std::move(fileContent), timeJsonVector).dump(4) << std::flush;
+
+	const bool jsonLines = (this->jsonLayout == "Lines");
+
+	// Frames start with the time index and instant
+	const auto & frames = outputBuffer.getFrames();
+	for(std::size_t f = 0; f < frames.size(); ++f)
+	{
+		const std::size_t timeIndex = static_cast<std::size_t>(frames[f][0]);
+		const json j{
+			{trajectory::timeField, frames[f][1]},
+			{trajectory::timeIndexField, timeIndex}
+		};
+		detail::write_json_entry(*mainFileMap["timeVector"], mainIndexMap["timeVector"], timeIndex, frames[f][1], j, first and f == 0, jsonLines);
+	}
+	mainFileMap["timeVector"]->flush();
+	mainIndexMap["timeVector"].flush();
+}
+
+template<
+	typename ... ParticleTypes,
+	typename ... BoundaryTypes,
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
+>
+void Simulator<
+	ParticleList<ParticleTypes...>,
+	BoundaryList<BoundaryTypes...>,
+	InteractionList<InteractionTypes...>,
+	IntegratorList<GearIntegrator>,
+	SeekerList<SeekerTypes...>
+>::exportParticles(const bool first)
+{
+	const std::vector<OutputField> & fields = (this->outputFormat != "JSON" and this->outputFields.empty()) ? detail::default_output_fields() : this->outputFields;
+	std::vector<double> values;
+	const bool jsonLines = (this->jsonLayout == "Lines");
+
+	const auto & frames = outputBuffer.getFrames();
+	for(std::size_t f = 0; f < frames.size(); ++f)
+	{
+		const double * state = frames[f].data() + 2;
+		const std::size_t timeIndex = static_cast<std::size_t>(frames[f][0]);
+
+		const bool firstEntry = (first and f == 0);
+
+		if(this->outputFormat == "Binary")
+		{
+			mp::visit<ParticleList, detail::export_particles_to_trajectory>::call_same(outputParticles, state, timeIndex, frames[f][1], fields, particleTrajectoryMap, values);
+		}
+		else if(this->outputFormat == "Frames")
+		{
+			values.clear();
+			mp::visit<ParticleList, detail::append_particles_to_frame>::call_same(outputParticles, state, fields, values);
+			particleFrameWriter.append(timeIndex, frames[f][1], values.data());
+		}
+		else if(this->outputFormat == "Compressed")
+		{
+			values.clear();
+			mp::visit<ParticleList, detail::append_particles_to_frame>::call_same(outputParticles, state, fields, values);
+			particleCompressedFrameWriter.append(timeIndex, frames[f][1], values.data());
+		}
+		else
+		{
+			mp::visit<ParticleList, detail::export_particles_to_json>::call_same(outputParticles, state, timeIndex, frames[f][1], fields, particleFileMap, particleIndexMap, firstEntry, jsonLines);
+		}
+
+		if(this->vtkOutput)
+		{
+			const double * vtkState = frames[f].data() + 2;
+			std::vector<double> points;
+			std::vector<vtk::DataArray> pointData = detail::vtk_point_data();
+			mp::visit<ParticleList, detail::append_particles_to_vtk>::call_same(outputParticles, vtkState, points, pointData);
+
+			const path dataSetPath("particles_" + std::to_string(timeIndex) + ".vtu");
+			vtk::writePointCloud(fileTree["output"]["vtk"].get<path>() / dataSetPath, points, pointData);
+			particleVtkSeries.add(frames[f][1], dataSetPath);
+		}
+	}
+
+	for(auto& file : particleFileMap)
+	{
+		file.second->flush();
+	}
+	for(auto& index : particleIndexMap)
+	{
+		index.second.flush();
+	}
+
+	// Each flush writes the records stored since the last one as a chunk
+	for(auto& trajectory : particleTrajectoryMap)
+	{
+		trajectory.second.flush();
+	}
+	particleFrameWriter.flush();
+	particleCompressedFrameWriter.flush();
+	particleVtkSeries.flush();
+}
+
+template<
+	typename ... ParticleTypes,
+	typename ... BoundaryTypes,
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
+>
+void Simulator<
+	ParticleList<ParticleTypes...>,
+	BoundaryList<BoundaryTypes...>,
+	InteractionList<InteractionTypes...>,
+	IntegratorList<GearIntegrator>,
+	SeekerList<SeekerTypes...>
+>::exportBoundaries(const bool first)
+{
+	const bool jsonLines = (this->jsonLayout == "Lines");
+
+	const auto & frames = outputBuffer.getFrames();
+	for(std::size_t f = 0; f < frames.size(); ++f)
+	{
+		const std::size_t timeIndex = static_cast<std::size_t>(frames[f][0]);
+		const bool firstEntry = (first and f == 0);
+
+		mp::visit<BoundaryList, detail::export_boundaries_to_json>::call_same(outputBoundaries, timeIndex, frames[f][1], boundaryFileMap, boundaryIndexMap, firstEntry, jsonLines);
+	}
+
+	for(auto& file : boundaryFileMap)
+	{
+		file.second->flush();
+	}
+	for(auto& index : boundaryIndexMap)
+	{
+		index.second.flush();
+	}
+}
+
+template<
+	typename ... ParticleTypes,
+	typename ... BoundaryTypes,
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
+>
+void Simulator<
+	ParticleList<ParticleTypes...>,
+	BoundaryList<BoundaryTypes...>,
+	InteractionList<InteractionTypes...>,
+	IntegratorList<GearIntegrator>,
+	SeekerList<SeekerTypes...>
+>::exportOutputBuffer()
+{
+	// The buffer is exported whenever it fills up and when the simulation ends, so an export
+	// may be the first to write to the JSON files whatever the step it runs at
+	{
+		auto phase = outputProfiler.time("Export");
+		auto event = tracer.unsampledScope("Export");
+		const bool first = not this->jsonEntriesWritten;
+		exportTime(first);
+		exportParticles(first);
+		exportBoundaries(first);
+	}
+	if(not outputBuffer.empty()) this->jsonEntriesWritten = true;
+
+	outputProfiler.endStep();
+	outputBuffer.clear();
 }
 
 template<typename InteractionTriplet>
@@ -916,14 +1773,15 @@ struct print_check
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::simulate()
 {
 	openFiles();
@@ -966,60 +1824,344 @@ void Simulator<
 		<< boost::typeindex::type_id_with_cvr<InteractionParticleBoundaryTriplets>().pretty_name() 
 		<< std::endl; // DEBUG
 
-	bool first = true;
+	// Without deterministic reduction, forces on the particle stores are summed per thread
+	this->pairEvaluator.clearTracked();
+	mp::visit<ParticleList, detail::track_particle_store>::call_same(particleStores, pairEvaluator);
+
+	// The writer thread restores these copies from output frames to serialize them
+	outputParticles = particles;
+	outputBoundaries = decltype(outputBoundaries)(boundaries);	// boundaries are not copy assignable
+
+	std::size_t frameSize = 0;
+
+	// Interaction statistics are written right after the interactions of each step that stores a frame
+	InteractionStatistics * statistics = nullptr;
+	if(this->keepInteractionStatistics)
+	{
+		statistics = &this->interactionStatistics;
+		statistics->setNumberOfThreads(threadPool.getNumberOfThreads());
+		mp::visit<ParticleList, detail::count_particles>::call_same(particles, *statistics);
+	}
+	bool firstStatisticsEntry = true;
+	const bool jsonLines = (this->jsonLayout == "Lines");
+
+	if(this->restarted)
+	{
+		time.resume(this->restartTimeIndex, this->restartInstant);
+		stepsForStoringCounter = this->restartStepsForStoringCounter;
+		storagesForWritingCounter = this->restartStoragesForWritingCounter;
+	}
+	else time.start();
+
+	const std::size_t firstTimeIndex = time.getIndex();
+
+	if(tracer.isEnabled()) tracer.nameThread("Simulation");
 
-	for(time.start(); !time.end(); time.update())
+	for(; !time.end(); time.update())
 	{
 		if(this->printTime) std::cout << time.as_json() << std::endl;
 
+		// Every TraceInterval-th step is traced as a whole, phase by phase and task by task
+		tracer.beginStep(time.getIndex());
+		auto stepEvent = tracer.scope("Step");
+
+		const bool storing = (stepsForStoringCounter == 0);
+
+		// Checkpoints hold the state at the beginning of a time step. There is no point in
+		// writing one for the state the loop started from.
+		if(this->checkpointInterval > 0 and time.getIndex() % this->checkpointInterval == 0 and time.getIndex() != firstTimeIndex)
+		{
+			auto phase = profiler.time("Checkpoint");
+			auto event = tracer.unsampledScope("Checkpoint");
+
+			// A run restarted from this checkpoint stores frames from this step on, so the frames
+			// stored before it must reach the output files first. Export flushes every stream and index.
+			outputWriter.push(
+				[this]()
+				{
+					if(tracer.isEnabled()) tracer.nameThread("Output");
+					exportOutputBuffer();
+				}
+			);
+			outputWriter.wait();
+
+			this->writeCheckpoint(time, stepsForStoringCounter, storagesForWritingCounter);
+		}
+
 		// Output
+		// The writer thread serializes a frame with the current state, so that the time loop
+		// only stalls when it gets more than outputWriter.getCapacity() frames ahead.
 		if(stepsForStoringCounter == 0)
 		{
-			timeJsonVector.push_back(time.as_json());
-			mp::visit<ParticleList, detail::write_particles_to_json>::call_same(particles, particleJsonMap, time);
-			mp::visit<BoundaryList, detail::write_boundaries_to_json>::call_same(boundaries, boundaryJsonMap, time);
+			auto phase = profiler.time("Snapshot");
+			auto event = tracer.unsampledScope("Snapshot");
+			const auto timePair = time.as_pair();
+
+			OutputBuffer::Frame frame;
+			frame.reserve(frameSize);
+			frame.push_back(timePair.first);
+			frame.push_back(timePair.second);
+			mp::visit<ParticleList, detail::write_particle_state>::call_same(particles, frame);
+			frameSize = frame.size();
+
+			// Frames are also written when they fill the output buffer, so that its memory stays bounded
+			const bool exportNow = (storagesForWritingCounter == 0);
+			outputWriter.push(
+				[this, frame = std::move(frame), exportNow]() mutable
+				{
+					outputBuffer.append(std::move(frame));
+
+					if(exportNow or outputBuffer.isFull())
+					{
+						if(tracer.isEnabled()) tracer.nameThread("Output");
+						exportOutputBuffer();
+					}
+				}
+			);
 
-			if(storagesForWritingCounter == 0)
-			{
-				exportTime(first);
-				exportParticles(first);
-				exportBoundaries(first);
-				first = false;
-			}
 			storagesForWritingCounter = (storagesForWritingCounter + 1) % storagesForWriting;
 		}
 		stepsForStoringCounter = (stepsForStoringCounter + 1) % stepsForStoring;
 
-		mp::visit<ParticleList, detail::initialize_particle>::call_same(particles);
-		mp::visit<ParticleList, detail::predict_particle>::call_same(particles, time);
-		mp::visit<BoundaryList, detail::update_boundary>::call_same(boundaries, time);
+		{
+			auto phase = profiler.time("Initialize");
+			auto event = tracer.scope("Initialize");
+			mp::visit<ParticleList, detail::initialize_particle>::call_same(particleStores, threadPool);
+		}
+		{
+			auto phase = profiler.time("Predict");
+			auto event = tracer.scope("Predict");
+			mp::visit<ParticleList, detail::predict_particle>::call_same(particleStores, time, threadPool);
+		}
+		{
+			auto phase = profiler.time("BoundaryUpdate");
+			auto event = tracer.scope("BoundaryUpdate");
+			mp::visit<BoundaryList, detail::update_boundary>::call_same(boundaries, time);
+		}
+		{
+			auto phase = profiler.time("SeekerUpdate");
+			auto event = tracer.scope("SeekerUpdate");
+			mp::visit<SeekerList, detail::update_seeker>::call_same(seekers, particles, seekerToUse);
+		}
 
+		// Each interaction triplet is timed as its own phase
 		mp::visit<InteractionParticleParticleTriplets, detail::interact_particle_particle>::call_same(
-				particles, time, interactionsToUse
+				particles, time, interactionsToUse, seekers, seekerToUse, contactHistories, pairEvaluator, profiler, tracer, statistics
 			);
 
 		mp::visit<InteractionParticleBoundaryTriplets, detail::interact_particle_boundary>::call_same(
-				particles, boundaries, time, interactionsToUse
+				particles, boundaries, time, interactionsToUse, contactHistories, pairEvaluator, profiler, tracer, statistics
 			);
 
-		mp::visit<ParticleList, detail::correct_particle>::call_same(particles, time);
+		if(statistics)
+		{
+			statistics->endStep();
+			if(storing)
+			{
+				const auto timePair = time.as_pair();
+				json entry = statistics->collect();
+				entry[trajectory::timeField] = timePair.second;
+				entry[trajectory::timeIndexField] = timePair.first;
+
+				detail::write_json_entry(interactionStatisticsFile, interactionStatisticsIndex, timePair.first, timePair.second, entry, firstStatisticsEntry, jsonLines);
+				interactionStatisticsFile.flush();
+				interactionStatisticsIndex.flush();
+				firstStatisticsEntry = false;
+			}
+		}
+
+		// Contacts that were not touched during this step have ended
+		{
+			auto phase = profiler.time("ContactHistory");
+			auto event = tracer.scope("ContactHistory");
+			mp::visit<InteractionList, detail::age_contact_history>::call_same(contactHistories);
+		}
+		{
+			auto phase = profiler.time("Correct");
+			auto event = tracer.scope("Correct");
+			mp::visit<ParticleList, detail::correct_particle>::call_same(particleStores, time, threadPool);
+		}
+
+		profiler.endStep();
 	}
 
 	this->endSimulation(time);
 }
+
+template<
+	typename ... ParticleTypes,
+	typename ... BoundaryTypes,
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
+>
+template<typename Time>
+void Simulator<
+	ParticleList<ParticleTypes...>,
+	BoundaryList<BoundaryTypes...>,
+	InteractionList<InteractionTypes...>,
+	IntegratorList<GearIntegrator>,
+	SeekerList<SeekerTypes...>
+>::writeCheckpoint(const Time & time, const unsigned long stepsForStoringCounter, const unsigned long storagesForWritingCounter) const
+{
+	const auto timePair = time.as_pair();
+
+	OutputBuffer::Frame state;
+	mp::visit<ParticleList, detail::write_particle_state>::call_same(particles, state);
+
+	json particleList = json::array();
+	mp::visit<ParticleList, detail::list_particles>::call_same(particles, particleList);
+
+	// The body holds every value bit for bit. The header is for people, and for restart() to
+	// check that the state belongs to the same particles, in the same order.
+	const json header{
+		{time.getIndexTag(), timePair.first},
+		{time.getTimeTag(), timePair.second},
+		{"TimeStep", this->timeStep},
+		{"Seeker", this->seekerToUse},
+		{"Interactions", this->interactionsToUse},
+		{"Particles", particleList}
+	};
+
+	CheckpointWriter checkpoint(fileTree["output"]["checkpoint"].get<path>(), header);
+
+	checkpoint.write( static_cast<std::uint64_t>(timePair.first) );
+	checkpoint.write(timePair.second);
+	checkpoint.write(this->timeStep);
+	checkpoint.write( static_cast<std::uint64_t>(stepsForStoringCounter) );
+	checkpoint.write( static_cast<std::uint64_t>(storagesForWritingCounter) );
+	checkpoint.write(state);
+	mp::visit<InteractionList, detail::write_contact_history>::call_same(contactHistories, checkpoint);
+
+	checkpoint.commit();
+}
+
+namespace detail {
+
+// Whether folder, or any folder inside it, holds a file
+inline bool holds_files(const path & folder)
+{
+	if(not filesystem::is_directory(folder)) return false;
+
+	for(filesystem::recursive_directory_iterator it(folder), end; it != end; ++it)
+	{
+		if(not filesystem::is_directory(it->path())) return true;
+	}
+	return false;
+}
+
+} // detail
+
+template<
+	typename ... ParticleTypes,
+	typename ... BoundaryTypes,
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
+>
+void Simulator<
+	ParticleList<ParticleTypes...>,
+	BoundaryList<BoundaryTypes...>,
+	InteractionList<InteractionTypes...>,
+	IntegratorList<GearIntegrator>,
+	SeekerList<SeekerTypes...>
+>::restart(const path & checkpointFilePath)
+{
+	fileTree["input"]["restart"] = checkpointFilePath;
+
+	// Output files are opened anew, which would erase the output that led to the checkpoint
+	for(const string folder : {"main", "particleDir", "boundaryDir"})
+	{
+		const path outputFolder = fileTree["output"][folder].get<path>();
+		if(detail::holds_files(outputFolder))
+		{
+			throw std::runtime_error("Restarting from " + checkpointFilePath.string() + " would overwrite the output in " + outputFolder.string() + ": a restarted simulation must write to empty output folders");
+		}
+	}
+
+	CheckpointReader checkpoint(checkpointFilePath);
+
+	std::uint64_t timeIndex = 0;
+	double time = 0.0;
+	double checkpointTimeStep = 0.0;
+	std::uint64_t checkpointStepsForStoringCounter = 0;
+	std::uint64_t checkpointStoragesForWritingCounter = 0;
+	checkpoint.read(timeIndex);
+	checkpoint.read(time);
+	checkpoint.read(checkpointTimeStep);
+	checkpoint.read(checkpointStepsForStoringCounter);
+	checkpoint.read(checkpointStoragesForWritingCounter);
+
+	if(checkpointTimeStep != this->timeStep)
+	{
+		throw std::runtime_error("Checkpoint " + checkpointFilePath.string() + " was written with another TimeStep");
+	}
+
+	// Particles are built from the input files, so that their properties are known: the checkpoint
+	// only overwrites their state, which must have the same layout. Contact histories refer to
+	// particles by their position, so each particle must also be where it was.
+	const json & header = checkpoint.getHeader();
+	if(header.count("Particles") == 0)
+	{
+		throw std::runtime_error("Checkpoint " + checkpointFilePath.string() + " does not list its particles");
+	}
+	const json & checkpointParticles = header.at("Particles");
+
+	json particleList = json::array();
+	mp::visit<ParticleList, detail::list_particles>::call_same(particles, particleList);
+	if(checkpointParticles.size() != particleList.size())
+	{
+		throw std::runtime_error("Checkpoint " + checkpointFilePath.string() + " holds " + std::to_string(checkpointParticles.size()) + " particles, but the simulation has " + std::to_string(particleList.size()));
+	}
+	for(std::size_t i = 0; i < particleList.size(); ++i)
+	{
+		if(checkpointParticles[i] != particleList[i])
+		{
+			throw std::runtime_error("Checkpoint " + checkpointFilePath.string() + " holds particle " + checkpointParticles[i].dump() + " where the simulation has " + particleList[i].dump());
+		}
+	}
+
+	OutputBuffer::Frame state;
+	OutputBuffer::Frame currentState;
+	checkpoint.read(state);
+	mp::visit<ParticleList, detail::write_particle_state>::call_same(particles, currentState);
+	if(state.size() != currentState.size())
+	{
+		throw std::runtime_error("Checkpoint " + checkpointFilePath.string() + " does not match the simulation's particles");
+	}
+
+	const double * particleState = state.data();
+	mp::visit<ParticleList, detail::restore_particle_state>::call_same(particles, particleState);
+	mp::visit<InteractionList, detail::read_contact_history>::call_same(contactHistories, checkpoint);
+
+	this->restarted = true;
+	this->restartTimeIndex = timeIndex;
+	this->restartInstant = time;
+	this->restartStepsForStoringCounter = checkpointStepsForStoringCounter % this->stepsForStoring;
+	this->restartStoragesForWritingCounter = checkpointStoragesForWritingCounter % this->storagesForWriting;
+}
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 void Simulator<
 	ParticleList<ParticleTypes...>,
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::printSuccessMessage() const
 {
+	mp::for_each< mp::provide_indices<SeekerList> >(
+	[&, this](auto Index)
+	{
+		using S = typename mp::get<Index, SeekerList>::type;
+		if( NamedType<S>::name == this->seekerToUse )
+		{
+			std::cout << "Seeker " << this->seekerToUse << ": " << std::get<S>(this->seekers).summary().dump() << std::endl;
+		}
+	});
+
 	std::cout << "Finished." << std::endl; // DEBUG
 }
 
@@ -1029,7 +2171,8 @@ void finalizeInteraction();
 template<
 	typename ... ParticleTypes,
 	typename ... BoundaryTypes,
-	typename ... InteractionTypes
+	typename ... InteractionTypes,
+	typename ... SeekerTypes
 >
 template<typename Time>
 void Simulator<
@@ -1037,21 +2180,41 @@ void Simulator<
 	BoundaryList<BoundaryTypes...>,
 	InteractionList<InteractionTypes...>,
 	IntegratorList<GearIntegrator>,
-	SeekerList<BlindSeeker>
+	SeekerList<SeekerTypes...>
 >::endSimulation(const Time & time)
 {
-	exportTime(false);
-	exportParticles(false);
-	exportBoundaries(false);
+	outputWriter.wait();
+	exportOutputBuffer();
 
-	*mainFileMap["timeVector"] << "]" << std::endl;
-	for(auto&& it = particleJsonMap.begin(); it != particleJsonMap.end(); ++it)
+	// JSON Lines files need no closing
+	if(this->jsonLayout == "Array")
+	{
+		*mainFileMap["timeVector"] << "]" << std::endl;
+		if(this->keepInteractionStatistics) interactionStatisticsFile << "]" << std::endl;
+		for(auto& file : particleFileMap)
+		{
+			*file.second << "]" << std::endl;
+		}
+		for(auto& file : boundaryFileMap)
+		{
+			*file.second << "]" << std::endl;
+		}
+	}
+	for(auto& trajectory : particleTrajectoryMap)
 	{
-		*particleFileMap[it->first] << "]" << std::endl;
+		trajectory.second.close();
 	}
-	for(auto&& it = boundaryJsonMap.begin(); it != boundaryJsonMap.end(); ++it)
+	particleFrameWriter.close();
+	particleCompressedFrameWriter.close();
+	particleVtkSeries.close();
+	interactionStatisticsFile.close();
+	interactionStatisticsIndex.close();
+	for(auto* indexMap : {&mainIndexMap, &particleIndexMap, &boundaryIndexMap})
 	{
-		*boundaryFileMap[it->first] << "]" << std::endl;
+		for(auto& index : *indexMap)
+		{
+			index.second.close();
+		}
 	}
 
 	mp::for_each< mp::provide_indices<InteractionList> >(
@@ -1061,6 +2224,12 @@ void Simulator<
 		psin::finalizeInteraction<I>();
 	});
 
+	if constexpr(Profiler::enabled)
+	{
+		write_profile(fileTree["output"]["main"].get<path>() / path("profile.json"), profiler, outputProfiler);
+	}
+	if(tracer.isEnabled()) tracer.write( fileTree["output"]["trace"].get<path>() );
+
 	this->printSuccessMessage();
 }
 
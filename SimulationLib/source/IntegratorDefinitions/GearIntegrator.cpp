@@ -0,0 +1,53 @@
+#include <IntegratorDefinitions/GearIntegrator.hpp>
+
+// Standard
+#include <cmath>
+
+namespace psin {
+
+// The operations below are the same ones performed by Interaction<>::taylorPredictor and
+// Interaction<>::gearCorrector, so that both give bit-identical results
+GearIntegrator::Coefficients::Coefficients(const double timeStep)
+	: timeStep(timeStep),
+	correctorCoefficients()
+{
+	for(std::size_t k = 0; k <= maxPredictionOrder; ++k)
+	{
+		predictorCoefficients[k] = std::pow(timeStep, k) / factorials[k];
+	}
+
+	for(std::size_t equationOrder = 0; equationOrder <= maxEquationOrder; ++equationOrder)
+	{
+		const double scaling = std::pow(timeStep, equationOrder) / factorials[equationOrder];
+
+		for(std::size_t predictionOrder = 0; predictionOrder <= maxPredictionOrder; ++predictionOrder)
+		{
+			if(not hasCorrector(equationOrder, predictionOrder)) continue;
+
+			for(std::size_t k = 0; k <= predictionOrder; ++k)
+			{
+				correctorCoefficients[equationOrder][predictionOrder][k] =
+					correctorConstants[equationOrder][predictionOrder][k] * ( factorials[k] / std::pow(timeStep, k) ) * scaling;
+			}
+		}
+	}
+}
+
+double GearIntegrator::Coefficients::getTimeStep() const
+{
+	return this->timeStep;
+}
+
+auto GearIntegrator::Coefficients::predictor() const
+	-> const CoefficientRow &
+{
+	return this->predictorCoefficients;
+}
+
+auto GearIntegrator::Coefficients::corrector(const std::size_t equationOrder, const std::size_t predictionOrder) const
+	-> const CoefficientRow &
+{
+	return this->correctorCoefficients[equationOrder][predictionOrder];
+}
+
+} // psin
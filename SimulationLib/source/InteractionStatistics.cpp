@@ -0,0 +1,187 @@
+#include <InteractionStatistics.hpp>
+
+// Standard
+#include <algorithm>
+
+namespace psin {
+
+InteractionCounters & InteractionCounters::operator+=(const InteractionCounters & other)
+{
+	this->candidatePairs += other.candidatePairs;
+	this->touchingPairs += other.touchingPairs;
+	this->contactsStarted += other.contactsStarted;
+	this->contactsEnded += other.contactsEnded;
+	return *this;
+}
+
+void to_json(json & j, const InteractionCounters & counters)
+{
+	j = json{
+		{"CandidatePairs", counters.candidatePairs},
+		{"TouchingPairs", counters.touchingPairs},
+		{"ContactsStarted", counters.contactsStarted},
+		{"ContactsEnded", counters.contactsEnded}
+	};
+}
+
+void InteractionStatistics::Triplet::countCandidate(const unsigned thread)
+{
+	++this->tallies[thread].counters.candidatePairs;
+}
+
+void InteractionStatistics::Triplet::countTouching(const unsigned thread, const index_pair & pair)
+{
+	Tally & tally = this->tallies[thread];
+	++tally.counters.touchingPairs;
+	tally.touching.push_back(pair);
+}
+
+void InteractionStatistics::setNumberOfThreads(const unsigned numberOfThreads)
+{
+	this->numberOfThreads = numberOfThreads;
+	for(auto & triplet : this->triplets)
+	{
+		triplet->tallies.resize(numberOfThreads);
+	}
+}
+
+void InteractionStatistics::setNumberOfParticles(const string & particleType, const std::size_t numberOfParticles)
+{
+	this->numberOfParticles[particleType] = numberOfParticles;
+}
+
+InteractionStatistics::Triplet & InteractionStatistics::triplet(const string & interaction, const string & entityType, const string & neighborType, const bool neighborIsParticle)
+{
+	for(auto & triplet : this->triplets)
+	{
+		if(triplet->interaction == interaction and triplet->entityType == entityType and triplet->neighborType == neighborType)
+		{
+			return *triplet;
+		}
+	}
+
+	this->triplets.push_back( std::make_unique<Triplet>() );
+	Triplet & triplet = *this->triplets.back();
+	triplet.interaction = interaction;
+	triplet.entityType = entityType;
+	triplet.neighborType = neighborType;
+	triplet.neighborIsParticle = neighborIsParticle;
+	triplet.tallies.resize(this->numberOfThreads);
+	return triplet;
+}
+
+void InteractionStatistics::endStep()
+{
+	for(auto & triplet : this->triplets)
+	{
+		std::swap(triplet->contacts, triplet->previousContacts);
+		triplet->contacts.clear();
+		for(Triplet::Tally & tally : triplet->tallies)
+		{
+			triplet->counters += tally.counters;
+			tally.counters = InteractionCounters();
+
+			triplet->contacts.insert(triplet->contacts.end(), tally.touching.begin(), tally.touching.end());
+			tally.touching.clear();
+		}
+		std::sort(triplet->contacts.begin(), triplet->contacts.end());
+
+		// Both lists are sorted, so the contacts that started and ended are found in a single pass
+		auto current = triplet->contacts.begin();
+		auto previous = triplet->previousContacts.begin();
+		while(current != triplet->contacts.end() or previous != triplet->previousContacts.end())
+		{
+			if(previous == triplet->previousContacts.end() or (current != triplet->contacts.end() and *current < *previous))
+			{
+				++triplet->counters.contactsStarted;
+				++current;
+			}
+			else if(current == triplet->contacts.end() or *previous < *current)
+			{
+				++triplet->counters.contactsEnded;
+				++previous;
+			}
+			else
+			{
+				++current;
+				++previous;
+			}
+		}
+	}
+	++this->steps;
+}
+
+json InteractionStatistics::collect()
+{
+	json interactions = json::array();
+	for(auto & triplet : this->triplets)
+	{
+		json entry = triplet->counters;
+		entry["Interaction"] = triplet->interaction;
+		entry["Entity"] = triplet->entityType;
+		entry["Neighbor"] = triplet->neighborType;
+		interactions.push_back(entry);
+
+		triplet->counters = InteractionCounters();
+	}
+
+	// Several interactions act on the same contact, as normal and tangential forces do, so each
+	// particle's contacts are listed as (particle, neighbor) and counted once
+	std::map<string, std::size_t> typeIndices;
+	auto typeIndexOf = [&typeIndices](const string & type){ return typeIndices.emplace(type, typeIndices.size()).first->second; };
+
+	using Entity = std::pair<std::size_t, std::size_t>;	// type index and index in its vector
+	std::vector< std::pair<Entity, Entity> > particleContacts;
+	for(auto & triplet : this->triplets)
+	{
+		const std::size_t entityType = typeIndexOf(triplet->entityType);
+		const std::size_t neighborType = typeIndexOf(triplet->neighborType);
+		for(const index_pair & contact : triplet->contacts)
+		{
+			const Entity entity{entityType, contact.first};
+			const Entity neighbor{neighborType, contact.second};
+			particleContacts.emplace_back(entity, neighbor);
+			if(triplet->neighborIsParticle) particleContacts.emplace_back(neighbor, entity);
+		}
+	}
+	std::sort(particleContacts.begin(), particleContacts.end());
+	particleContacts.erase(std::unique(particleContacts.begin(), particleContacts.end()), particleContacts.end());
+
+	std::map<string, std::vector<unsigned>> coordinationNumbers;
+	for(const auto & particleType : this->numberOfParticles)
+	{
+		std::vector<unsigned> & coordinationNumber = coordinationNumbers[particleType.first];
+		coordinationNumber.assign(particleType.second, 0);
+
+		const std::size_t type = typeIndexOf(particleType.first);
+		for(const auto & contact : particleContacts)
+		{
+			if(contact.first.first == type and contact.first.second < coordinationNumber.size()) ++coordinationNumber[contact.first.second];
+		}
+	}
+
+	std::vector<unsigned long> histogram;
+	unsigned long particles = 0;
+	unsigned long contacts = 0;
+	for(const auto & particleType : this->numberOfParticles)
+	{
+		for(const unsigned coordinationNumber : coordinationNumbers[particleType.first])
+		{
+			if(coordinationNumber >= histogram.size()) histogram.resize(coordinationNumber + 1, 0);
+			++histogram[coordinationNumber];
+			++particles;
+			contacts += coordinationNumber;
+		}
+	}
+
+	json j{
+		{"Steps", this->steps},
+		{"Interactions", interactions},
+		{"CoordinationNumbers", histogram},
+		{"MeanCoordinationNumber", particles > 0 ? double(contacts) / particles : 0.0}
+	};
+	this->steps = 0;
+	return j;
+}
+
+} // psin
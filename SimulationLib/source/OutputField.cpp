@@ -0,0 +1,194 @@
+#include <OutputField.hpp>
+
+// Standard
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+namespace psin {
+
+namespace {
+
+const std::map<string, OutputField::Quantity> & quantities()
+{
+	using Quantity = OutputField::Quantity;
+	static const std::map<string, Quantity> quantities{
+		{"Position", Quantity::Position},
+		{"Velocity", Quantity::Velocity},
+		{"Acceleration", Quantity::Acceleration},
+		{"Orientation", Quantity::Orientation},
+		{"AngularVelocity", Quantity::AngularVelocity},
+		{"AngularAcceleration", Quantity::AngularAcceleration},
+		{"PositionMatrix", Quantity::PositionMatrix},
+		{"OrientationMatrix", Quantity::OrientationMatrix},
+		{"bodyForce", Quantity::BodyForce},
+		{"contactForce", Quantity::ContactForce},
+		{"resultingForce", Quantity::ResultingForce},
+		{"resultingTorque", Quantity::ResultingTorque},
+		{"linearMomentum", Quantity::LinearMomentum},
+		{"angularMomentum", Quantity::AngularMomentum},
+		{"kineticEnergy", Quantity::KineticEnergy},
+		{"translationalEnergy", Quantity::TranslationalEnergy},
+		{"rotationalEnergy", Quantity::RotationalEnergy}
+	};
+	return quantities;
+}
+
+} // anonymous namespace
+
+OutputField::OutputField(const string & name)
+	: name(name)
+{
+	const auto it = quantities().find(name);
+	if(it == quantities().end())
+	{
+		throw std::runtime_error("Unknown output field " + name);
+	}
+	this->quantity = it->second;
+}
+
+const string & OutputField::getName() const
+{
+	return this->name;
+}
+
+OutputField::Quantity OutputField::getQuantity() const
+{
+	return this->quantity;
+}
+
+void OutputField::setTaylorOrders(const std::vector<std::size_t> & taylorOrders)
+{
+	if(not taylorOrders.empty() and not this->isMatrix())
+	{
+		throw std::runtime_error("Only PositionMatrix and OrientationMatrix accept TaylorOrders, not " + this->name);
+	}
+
+	this->taylorOrders = taylorOrders;
+}
+
+const std::vector<std::size_t> & OutputField::getTaylorOrders() const
+{
+	return this->taylorOrders;
+}
+
+void OutputField::setPrecision(const int precision)
+{
+	if(precision < 0 or precision > std::numeric_limits<double>::max_digits10)
+	{
+		throw std::runtime_error("The precision of output field " + this->name + " must be between 0 and " + std::to_string(std::numeric_limits<double>::max_digits10));
+	}
+
+	this->precision = precision;
+}
+
+int OutputField::getPrecision() const
+{
+	return this->precision;
+}
+
+void OutputField::setType(const string & type)
+{
+	trajectory::valueSize(type);
+	this->type = type;
+}
+
+const string & OutputField::getType() const
+{
+	return this->type;
+}
+
+void OutputField::setTolerance(const double tolerance)
+{
+	if(not (tolerance >= 0.0))
+	{
+		throw std::runtime_error("The tolerance of output field " + this->name + " must not be negative");
+	}
+
+	this->tolerance = tolerance;
+}
+
+double OutputField::getTolerance() const
+{
+	return this->tolerance;
+}
+
+bool OutputField::isMatrix() const
+{
+	return this->quantity == Quantity::PositionMatrix or this->quantity == Quantity::OrientationMatrix;
+}
+
+bool OutputField::isScalar() const
+{
+	return this->quantity == Quantity::KineticEnergy
+		or this->quantity == Quantity::TranslationalEnergy
+		or this->quantity == Quantity::RotationalEnergy;
+}
+
+std::size_t OutputField::getComponents(const std::size_t taylorOrder) const
+{
+	if(this->isScalar()) return 1;
+	if(this->isMatrix()) return 3 * this->getRows(taylorOrder).size();
+	return 3;
+}
+
+std::vector<std::size_t> OutputField::getRows(const std::size_t taylorOrder) const
+{
+	if(this->taylorOrders.empty())
+	{
+		std::vector<std::size_t> rows(taylorOrder + 1);
+		for(std::size_t row = 0; row <= taylorOrder; ++row) rows[row] = row;
+		return rows;
+	}
+
+	if(*std::max_element(this->taylorOrders.begin(), this->taylorOrders.end()) > taylorOrder)
+	{
+		throw std::runtime_error("Output field " + this->name + " asks for a derivative above Taylor order " + std::to_string(taylorOrder));
+	}
+	return this->taylorOrders;
+}
+
+double OutputField::round(const double value) const
+{
+	int digits = this->precision;
+	if(digits == 0 and this->type == trajectory::float32Type)
+	{
+		digits = std::numeric_limits<float>::max_digits10;
+	}
+	if(digits == 0) return value;
+
+	char text[32];
+	std::snprintf(text, sizeof(text), "%.*g", digits, value);
+	return std::strtod(text, nullptr);
+}
+
+void to_json(json & j, const OutputField & field)
+{
+	j = json{
+		{"Name", field.getName()},
+		{"Type", field.getType()}
+	};
+	if(not field.getTaylorOrders().empty()) j["TaylorOrders"] = field.getTaylorOrders();
+	if(field.getPrecision() > 0) j["Precision"] = field.getPrecision();
+	if(field.getTolerance() > 0.0) j["Tolerance"] = field.getTolerance();
+}
+
+void from_json(const json & j, OutputField & field)
+{
+	if(j.is_string())
+	{
+		field = OutputField( j.get<string>() );
+		return;
+	}
+
+	field = OutputField( j.at("Name").get<string>() );
+	if(j.count("TaylorOrders") > 0) field.setTaylorOrders( j.at("TaylorOrders").get<std::vector<std::size_t>>() );
+	if(j.count("Precision") > 0) field.setPrecision( j.at("Precision").get<int>() );
+	if(j.count("Type") > 0) field.setType( j.at("Type").get<string>() );
+	if(j.count("Tolerance") > 0) field.setTolerance( j.at("Tolerance").get<double>() );
+}
+
+} // psin
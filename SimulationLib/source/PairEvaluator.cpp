@@ -0,0 +1,73 @@
+#include <PairEvaluator.hpp>
+
+namespace psin {
+
+PairEvaluator::PairEvaluator(ThreadPool & threadPool)
+	: threadPool(threadPool)
+{
+}
+
+void PairEvaluator::setDeterministic(const bool deterministic)
+{
+	this->deterministic = deterministic;
+	this->recorders.clear();
+}
+
+bool PairEvaluator::isDeterministic() const
+{
+	return this->deterministic;
+}
+
+bool PairEvaluator::isSerial() const
+{
+	return this->threadPool.getNumberOfThreads() == 1;
+}
+
+void PairEvaluator::clearTracked()
+{
+	this->trackedColumns.clear();
+	this->recorders.clear();
+}
+
+std::vector<PairEvaluator::index_pair> & PairEvaluator::pairs()
+{
+	return this->pairBuffer;
+}
+
+// Recorders are rebuilt whenever the number of threads, the tracked columns or the reduction mode change
+void PairEvaluator::prepareRecorders()
+{
+	if(this->recorders.size() == this->threadPool.getNumberOfThreads()) return;
+
+	this->recorders.clear();
+	this->recorders.resize(this->threadPool.getNumberOfThreads());
+
+	if(not this->deterministic)
+	{
+		for(DynamicsRecorder & recorder : this->recorders)
+		{
+			for(const auto & column : this->trackedColumns)
+			{
+				recorder.track(column.first, column.second);
+			}
+		}
+	}
+}
+
+void PairEvaluator::reduce()
+{
+	for(std::size_t column = 0; column < this->recorders.front().numberOfTrackedColumns(); ++column)
+	{
+		this->threadPool.parallel_for(this->trackedColumns[column].second, [&, this](const std::size_t begin, const std::size_t end)
+		{
+			DynamicsRecorder::reduceColumns(this->recorders, column, begin, end);
+		});
+	}
+
+	for(DynamicsRecorder & recorder : this->recorders)
+	{
+		recorder.apply();
+	}
+}
+
+} // psin
@@ -0,0 +1,133 @@
+#include <Profiler.hpp>
+
+// Standard
+#include <algorithm>
+#include <cmath>
+
+namespace psin {
+
+namespace {
+
+// Histogram bins are 1/binsPerOctave of an octave of nanoseconds wide
+constexpr int binsPerOctave = 16;
+
+double seconds(const BasicProfiler<true>::Clock::duration duration)
+{
+	return std::chrono::duration<double>(duration).count();
+}
+
+std::size_t binOf(const BasicProfiler<true>::Clock::duration duration)
+{
+	const double nanoseconds = std::chrono::duration<double, std::nano>(duration).count();
+	if(nanoseconds < 1.0) return 0;
+	return static_cast<std::size_t>( std::log2(nanoseconds) * binsPerOctave ) + 1;
+}
+
+// Geometric center of the bin
+double secondsOf(const std::size_t bin)
+{
+	if(bin == 0) return 0.0;
+	return std::exp2( (bin - 0.5) / binsPerOctave ) * 1e-9;
+}
+
+} // anonymous namespace
+
+BasicProfiler<true>::Scope::Scope(BasicProfiler & profiler, const std::size_t phase)
+	: profiler(&profiler), phase(phase), start(Clock::now())
+{}
+
+BasicProfiler<true>::Scope::Scope(Scope && other)
+	: profiler(other.profiler), phase(other.phase), start(other.start)
+{
+	other.profiler = nullptr;
+}
+
+BasicProfiler<true>::Scope::~Scope()
+{
+	if(this->profiler) this->profiler->add(this->phase, Clock::now() - this->start);
+}
+
+void BasicProfiler<true>::add(const std::size_t phase, const Clock::duration duration)
+{
+	this->phases[phase].step += duration;
+	++this->phases[phase].stepCalls;
+}
+
+std::size_t BasicProfiler<true>::phaseOf(const string & name)
+{
+	const auto it = this->phaseIndices.find(name);
+	if(it != this->phaseIndices.end()) return it->second;
+
+	this->phases.push_back(Phase{name});
+	this->phaseIndices.emplace(name, this->phases.size() - 1);
+	return this->phases.size() - 1;
+}
+
+void BasicProfiler<true>::endStep()
+{
+	for(Phase & phase : this->phases)
+	{
+		if(phase.stepCalls == 0) continue;
+
+		phase.calls += phase.stepCalls;
+		++phase.steps;
+		phase.total += phase.step;
+		phase.min = std::min(phase.min, phase.step);
+		phase.max = std::max(phase.max, phase.step);
+
+		const std::size_t bin = binOf(phase.step);
+		if(bin >= phase.histogram.size()) phase.histogram.resize(bin + 1, 0);
+		++phase.histogram[bin];
+
+		phase.step = Clock::duration::zero();
+		phase.stepCalls = 0;
+	}
+	++this->numberOfSteps;
+}
+
+std::size_t BasicProfiler<true>::getNumberOfSteps() const
+{
+	return this->numberOfSteps;
+}
+
+json BasicProfiler<true>::report() const
+{
+	json phases = json::array();
+	for(const Phase & phase : this->phases)
+	{
+		if(phase.steps == 0) continue;
+
+		json percentiles = json::object();
+		for(const unsigned percentile : {50, 90, 99})
+		{
+			// Smallest bin holding at least percentile% of the steps
+			const unsigned long rank = (phase.steps * percentile + 99) / 100;
+			unsigned long count = 0;
+			std::size_t bin = 0;
+			while(count + phase.histogram[bin] < rank)
+			{
+				count += phase.histogram[bin];
+				++bin;
+			}
+			percentiles[std::to_string(percentile)] = std::min(std::max(secondsOf(bin), seconds(phase.min)), seconds(phase.max));
+		}
+
+		phases.push_back({
+			{"Name", phase.name},
+			{"Calls", phase.calls},
+			{"Steps", phase.steps},
+			{"Total", seconds(phase.total)},
+			{"MeanPerStep", seconds(phase.total) / phase.steps},
+			{"MinPerStep", seconds(phase.min)},
+			{"MaxPerStep", seconds(phase.max)},
+			{"PercentilesPerStep", percentiles}
+		});
+	}
+
+	return json{
+		{"Steps", this->numberOfSteps},
+		{"Phases", phases}
+	};
+}
+
+} // psin
@@ -0,0 +1,15 @@
+#include <SeekerDefinitions/BlindSeeker.hpp>
+
+namespace psin {
+
+template<> const std::string NamedType<BlindSeeker>::name = "BlindSeeker";
+
+void BlindSeeker::setup(const json & j)
+{}
+
+json BlindSeeker::summary() const
+{
+	return json::object();
+}
+
+} // psin
@@ -0,0 +1,71 @@
+#include <SeekerDefinitions/GridSeeker.hpp>
+
+// Standard
+#include <algorithm>
+#include <cmath>
+
+namespace psin {
+
+template<> const std::string NamedType<GridSeeker>::name = "GridSeeker";
+
+GridSeeker::GridSeeker(const double margin)
+	: margin(margin)
+{}
+
+void GridSeeker::setup(const json & j)
+{
+	if(j.count("Margin") > 0) this->margin = j.at("Margin");
+}
+
+double GridSeeker::getCellSize() const
+{
+	return this->cellSize;
+}
+
+json GridSeeker::summary() const
+{
+	return json{
+		{"CellSize", this->cellSize}
+	};
+}
+
+std::size_t GridSeeker::cell_hash::operator()(const cell_index & cell) const
+{
+	// Large primes spread neighbouring cells over distinct buckets
+	return static_cast<std::size_t>(cell[0]) * 73856093u
+		^ static_cast<std::size_t>(cell[1]) * 19349663u
+		^ static_cast<std::size_t>(cell[2]) * 83492791u;
+}
+
+GridSeeker::cell_index GridSeeker::cellOf(const Vector3D & position, const double cellSize)
+{
+	return cell_index{{
+		static_cast<long>( std::floor(position.x() / cellSize) ),
+		static_cast<long>( std::floor(position.y() / cellSize) ),
+		static_cast<long>( std::floor(position.z() / cellSize) )
+	}};
+}
+
+void GridSeeker::CellList::build(const std::vector<Vector3D> & positions, const double cellSize)
+{
+	entries.clear();
+	ranges.clear();
+
+	for(std::size_t i = 0; i < positions.size(); ++i)
+	{
+		entries.emplace_back( cellOf(positions[i], cellSize), i );
+	}
+
+	std::sort(entries.begin(), entries.end());
+
+	for(std::size_t begin = 0; begin < entries.size(); )
+	{
+		std::size_t end = begin + 1;
+		while(end < entries.size() and entries[end].first == entries[begin].first) ++end;
+
+		ranges.emplace(entries[begin].first, std::make_pair(begin, end));
+		begin = end;
+	}
+}
+
+} // psin
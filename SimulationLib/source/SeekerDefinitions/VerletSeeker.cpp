@@ -0,0 +1,71 @@
+#include <SeekerDefinitions/VerletSeeker.hpp>
+
+// Standard
+#include <algorithm>
+#include <stdexcept>
+
+namespace psin {
+
+template<> const std::string NamedType<VerletSeeker>::name = "VerletSeeker";
+
+VerletSeeker::VerletSeeker()
+{}
+
+VerletSeeker::VerletSeeker(const double skin)
+	: skin(skin), fixedSkin(true), grid(skin)
+{
+	if(this->skin < 0.0) throw std::runtime_error("VerletSeeker: Skin must be non-negative");
+}
+
+void VerletSeeker::setup(const json & j)
+{
+	if(j.count("Skin") > 0)
+	{
+		this->skin = j.at("Skin");
+		this->fixedSkin = true;
+	}
+	if(this->skin < 0.0) throw std::runtime_error("VerletSeeker: Skin must be non-negative");
+
+	this->grid = GridSeeker(this->skin);
+}
+
+double VerletSeeker::getSkin() const
+{
+	return this->skin;
+}
+
+unsigned long VerletSeeker::getRebuildCount() const
+{
+	return this->rebuildCount;
+}
+
+json VerletSeeker::summary() const
+{
+	return json{
+		{"Skin", this->skin},
+		{"Updates", this->updateCount},
+		{"Rebuilds", this->rebuildCount}
+	};
+}
+
+void VerletSeeker::NeighborList::build(std::vector< std::pair<std::size_t, std::size_t> > & pairs, const std::size_t numberOfEntities)
+{
+	std::sort(pairs.begin(), pairs.end());
+
+	begin.assign(numberOfEntities + 1, 0);
+	neighbors.clear();
+	neighbors.reserve(pairs.size());
+
+	for(auto&& pair : pairs)
+	{
+		++begin[pair.first + 1];
+		neighbors.push_back(pair.second);
+	}
+
+	for(std::size_t i = 0; i < numberOfEntities; ++i)
+	{
+		begin[i + 1] += begin[i];
+	}
+}
+
+} // psin
@@ -16,13 +16,21 @@
 // InteractionLib
 #include <InteractionDefinitions.hpp>
 
+// IOLib
+#include <JsonLinesReader.hpp>
+
 // SimulationLib
 #include <CommandLineParser.hpp>
+#include <InteractionStatistics.hpp>
 #include <InteractionSubjectLister.hpp>
+#include <OutputField.hpp>
+#include <PairEvaluator.hpp>
+#include <Profiler.hpp>
 #include <ProgramOptions.hpp>
 #include <Simulator.hpp>
 
 // Standard
+#include <thread>
 #include <type_traits>
 
 using namespace std;
@@ -116,6 +124,9 @@ TestCase(InteractionSubjectLister_Test)
 	));
 }
 
+// The working directory the tests were started from, before any of them changes it
+const path initialPath = psin::filesystem::current_path();
+
 TestCase(Simulation_Instantiation_Test)
 {
 	Simulator<
@@ -135,14 +146,14 @@ TestCase(Simulation_Instantiation_Test)
 			TangentialForceCundallStrack,
 			TangentialForceHaffWerner
 			>,
-		LooperList<GearLooper>,
+		IntegratorList<GearIntegrator>,
 		SeekerList<BlindSeeker>
 	> simulation;
 }
 
 TestCase(Simulation_setup_Test)
 {
-	path projectRootPath = filesystem::current_path().parent_path().parent_path().parent_path();	
+	path projectRootPath = initialPath.parent_path().parent_path().parent_path();	
 	program_options::options_description desc("Allowed options");
 	desc.add_options()
 		("help", "produce help message")
@@ -180,10 +191,12 @@ TestCase(Simulation_setup_Test)
 			TangentialForceCundallStrack,
 			TangentialForceHaffWerner
 			>,
-		LooperList<GearLooper>,
+		IntegratorList<GearIntegrator>,
 		SeekerList<BlindSeeker>
 	> simulation;
 
+	// Paths in main.json are relative to the project's root folder
+	psin::filesystem::current_path(projectRootPath);
 	path simulationLibTestPath = projectRootPath / "SimulationLibTest";
 	path mainInputFilePath = simulationLibTestPath / "SimulationInputFiles" / "main.json";
 
@@ -192,7 +205,7 @@ TestCase(Simulation_setup_Test)
 
 TestCase(Simulation_setup_and_outputMainData_Test)
 {
-	path projectRootPath = filesystem::current_path().parent_path().parent_path().parent_path();	
+	path projectRootPath = initialPath.parent_path().parent_path().parent_path();	
 	program_options::options_description desc("Allowed options");
 	desc.add_options()
 		("help", "produce help message")
@@ -230,10 +243,12 @@ TestCase(Simulation_setup_and_outputMainData_Test)
 			TangentialForceCundallStrack,
 			TangentialForceHaffWerner
 			>,
-		LooperList<GearLooper>,
+		IntegratorList<GearIntegrator>,
 		SeekerList<BlindSeeker>
 	> simulation;
 
+	// Paths in main.json are relative to the project's root folder
+	psin::filesystem::current_path(projectRootPath);
 	path simulationLibTestPath = projectRootPath / "SimulationLibTest";
 	path mainInputFilePath = simulationLibTestPath / "SimulationInputFiles" / "main.json";
 
@@ -246,7 +261,7 @@ TestCase(Simulation_setup_and_outputMainData_Test)
 
 TestCase(Simulation_simulate_Test)
 {
-	path projectRootPath = filesystem::current_path().parent_path().parent_path().parent_path();	
+	path projectRootPath = initialPath.parent_path().parent_path().parent_path();	
 	program_options::options_description desc("Allowed options");
 	desc.add_options()
 		("help", "produce help message")
@@ -284,10 +299,12 @@ TestCase(Simulation_simulate_Test)
 			TangentialForceCundallStrack,
 			TangentialForceHaffWerner
 			>,
-		LooperList<GearLooper>,
+		IntegratorList<GearIntegrator>,
 		SeekerList<BlindSeeker>
 	> simulation;
 
+	// Paths in main.json are relative to the project's root folder
+	psin::filesystem::current_path(projectRootPath);
 	path simulationLibTestPath = projectRootPath / "SimulationLibTest";
 	path mainInputFilePath = simulationLibTestPath / "SimulationInputFiles" / "main.json";
 
@@ -301,7 +318,7 @@ TestCase(Simulation_simulate_Test)
 
 TestCase(Simulation_simulate_with_boundary_Test)
 {
-	path projectRootPath = filesystem::current_path().parent_path().parent_path().parent_path();	
+	path projectRootPath = initialPath.parent_path().parent_path().parent_path();	
 	program_options::options_description desc("Allowed options");
 	desc.add_options()
 		("help", "produce help message")
@@ -351,10 +368,12 @@ TestCase(Simulation_simulate_with_boundary_Test)
 		ParticleList,
 		BoundaryList,
 		InteractionList,
-		LooperList<GearLooper>,
+		IntegratorList<GearIntegrator>,
 		SeekerList<BlindSeeker>
 	> simulation;
 
+	// Paths in main.json are relative to the project's root folder
+	psin::filesystem::current_path(projectRootPath);
 	path simulationLibTestPath = projectRootPath / "SimulationLibTest";
 	path mainInputFilePath = simulationLibTestPath / "SimulationInputFiles" / "main.json";
 
@@ -368,51 +387,380 @@ TestCase(Simulation_simulate_with_boundary_Test)
 	simulation.simulate();
 }
 
-TestCase(SimulationFileTreeTest)
+TestCase(GridSeeker_Test)
+{
+	using SmallSphere = SphericalParticle<Mass>;
+	using LargeSphere = SphericalParticle<Mass, Color>;
+
+	std::tuple< vector<SmallSphere>, vector<LargeSphere> > particles;
+
+	for(int i = 0; i < 40; ++i)
+	{
+		SmallSphere small;
+		small.set<Radius>(0.01);
+		small.setPosition( 0.013 * (i % 7), 0.017 * (i / 7), -0.011 * (i % 3) );
+		std::get< vector<SmallSphere> >(particles).push_back(small);
+
+		LargeSphere large;
+		large.set<Radius>(0.03);
+		large.setPosition( 0.021 * (i % 5) - 0.05, 0.019 * (i / 5), 0.007 * (i % 4) );
+		std::get< vector<LargeSphere> >(particles).push_back(large);
+	}
+
+	GridSeeker gridSeeker;
+	gridSeeker.update(particles);
+	checkClose(gridSeeker.getCellSize(), 0.06, 1e-12);
+
+	auto countTouches = [&particles](const auto & seeker, auto * entityTag, auto * neighborTag)
+	{
+		using EntityType = std::remove_pointer_t<decltype(entityTag)>;
+		using NeighborType = std::remove_pointer_t<decltype(neighborTag)>;
+
+		std::size_t visited = 0;
+		std::size_t touching = 0;
+		seeker.template for_each_candidate<EntityType, NeighborType>(particles,
+			[&](EntityType & entity, NeighborType & neighbor)
+			{
+				++visited;
+				if(touch(entity, neighbor)) ++touching;
+			});
+		return std::make_pair(visited, touching);
+	};
+
+	BlindSeeker blindSeeker;
+
+	auto blindSmall = countTouches(blindSeeker, (SmallSphere*) nullptr, (SmallSphere*) nullptr);
+	auto gridSmall = countTouches(gridSeeker, (SmallSphere*) nullptr, (SmallSphere*) nullptr);
+	checkEqual(blindSmall.first, 40u * 39u / 2u);
+	checkEqual(gridSmall.second, blindSmall.second);
+	check(gridSmall.first <= blindSmall.first);
+	check(blindSmall.second > 0);
+
+	auto blindMixed = countTouches(blindSeeker, (SmallSphere*) nullptr, (LargeSphere*) nullptr);
+	auto gridMixed = countTouches(gridSeeker, (SmallSphere*) nullptr, (LargeSphere*) nullptr);
+	checkEqual(blindMixed.first, 40u * 40u);
+	checkEqual(gridMixed.second, blindMixed.second);
+	check(blindMixed.second > 0);
+}
+
+TestCase(VerletSeeker_Test)
+{
+	using Sphere = SphericalParticle<Mass>;
+
+	std::tuple< vector<Sphere> > particles;
+	vector<Sphere> & spheres = std::get< vector<Sphere> >(particles);
+
+	for(int i = 0; i < 3; ++i)
+	{
+		Sphere sphere;
+		sphere.set<Radius>(0.01);
+		sphere.setPosition( 0.025 * i, 0.0, 0.0 );
+		spheres.push_back(sphere);
+	}
+
+	VerletSeeker seeker;
+	seeker.setup( json{ {"Skin", 0.01} } );
+
+	auto countCandidates = [&]()
+	{
+		std::size_t candidates = 0;
+		seeker.for_each_candidate<Sphere, Sphere>(particles, [&](Sphere & entity, Sphere & neighbor){ ++candidates; });
+		return candidates;
+	};
+
+	seeker.update(particles);
+	checkEqual(seeker.getRebuildCount(), 1u);
+	checkEqual(countCandidates(), 2u); // gaps of 0.005 are within the skin, 0.03 is not
+
+	spheres[2].setPosition( 0.054, 0.0, 0.0 ); // moves less than half the skin
+	seeker.update(particles);
+	checkEqual(seeker.getRebuildCount(), 1u);
+	checkEqual(countCandidates(), 2u);
+
+	spheres[2].setPosition( 0.056, 0.0, 0.0 ); // moves more than half the skin
+	seeker.update(particles);
+	checkEqual(seeker.getRebuildCount(), 2u);
+	checkEqual(countCandidates(), 1u);
+
+	// Without a Skin, it is a fraction of the smallest radius
+	spheres[0].set<Radius>(0.008);
+	VerletSeeker automatic;
+	automatic.setup( json::object() );
+	automatic.update(particles);
+	checkClose(automatic.getSkin(), VerletSeeker::defaultRelativeSkin * 0.008, 1e-12);
+
+	spheres[2].setPosition( 0.0565, 0.0, 0.0 ); // moves less than half the skin
+	automatic.update(particles);
+	checkEqual(automatic.getRebuildCount(), 1u);
+
+	BOOST_CHECK_THROW(VerletSeeker(-0.01), std::runtime_error);
+}
+
+TestCase(ParticleStore_Test)
+{
+	using Sphere = SphericalParticle<Mass, MomentOfInertia>;
+	const double dt = 1e-3;
+
+	vector<Sphere> spheres(2);
+	for(std::size_t i = 0; i < spheres.size(); ++i)
+	{
+		spheres[i].setTaylorOrder(3 + i);
+		spheres[i].set<Mass>(1.0 + i);
+		spheres[i].set<MomentOfInertia>(0.1);
+		spheres[i].setPosition( 1.0 * i, 0.0, 0.0 );
+		spheres[i].setVelocity( 0.0, 2.0, 0.0 );
+		spheres[i].setAngularVelocity( 0.0, 0.0, 3.0 );
+	}
+	vector<Vector3D> expectedPosition = Interaction<>::taylorPredictor(spheres[1].getPositionMatrix(), 4, dt);
+
+	ParticleStore<Sphere> store;
+	store.bind(spheres);
+
+	checkEqual(store.size(), 2u);
+	checkEqual(store.getTaylorOrder(), 4u);
+	check(spheres[0].isSpatialStorageBound());
+	check(store.position(0)[1] == Vector3D(1.0, 0.0, 0.0));
+
+	// particles are views over the store
+	spheres[0].addContactForce( Vector3D(0.0, 0.0, -1.0) );
+	store.position(1)[0] = Vector3D(0.0, 5.0, 0.0);
+	check(spheres[0].getVelocity() == Vector3D(0.0, 5.0, 0.0));
+
+	store.resetForces();
+	check(spheres[0].getContactForce() == nullVector3D());
+
+	store.predict(GearIntegrator::Coefficients(dt));
+	for(std::size_t derivative = 0; derivative <= 4; ++derivative)
+	{
+		check(spheres[1].getPositionDerivative(derivative) == expectedPosition[derivative]);
+	}
+
+	// copies do not share the store
+	Sphere copy = spheres[1];
+	copy.setPosition( -1.0, 0.0, 0.0 );
+	check(not copy.isSpatialStorageBound());
+	check(spheres[1].getPosition() == expectedPosition[0]);
+
+	store.unbind(spheres);
+	check(not spheres[1].isSpatialStorageBound());
+	check(spheres[1].getPosition() == expectedPosition[0]);
+}
+
+TestCase(GearIntegrator_Test)
+{
+	const double dt = 1e-3;
+	const GearIntegrator::Coefficients coefficients(dt);
+
+	check(GearIntegrator::hasCorrector(2, 4));
+	check(not GearIntegrator::hasCorrector(2, 2));
+	check(not GearIntegrator::hasCorrector(3, 4));
+
+	const auto taylorCoefficients = Interaction<>::taylorCoefficients<GearIntegrator::maxPredictionOrder>(dt);
+	const auto correctorFactors = Interaction<>::gearCorrectorFactors<2, 4>(dt);
+	for(std::size_t k = 0; k <= 4; ++k)
+	{
+		check(coefficients.predictor()[k] == taylorCoefficients[k]);
+		check(coefficients.corrector(2, 4)[k] == correctorFactors[k]);
+	}
+}
+
+TestCase(PairEvaluator_Test)
+{
+	using Sphere = SphericalParticle<Mass, MomentOfInertia>;
+
+	vector<Sphere> spheres(40);
+	for(std::size_t i = 0; i < spheres.size(); ++i)
+	{
+		spheres[i].setHandle(i);
+		spheres[i].set<Mass>(1.0);
+		spheres[i].set<MomentOfInertia>(1.0);
+	}
+	ParticleStore<Sphere> store;
+	store.bind(spheres);
+
+	vector<PairEvaluator::index_pair> pairs;
+	for(std::size_t i = 0; i < spheres.size(); ++i)
+		for(std::size_t j = i + 1; j < spheres.size(); ++j)
+			pairs.emplace_back(i, j);
+
+	auto interact = [&](const std::size_t pair)
+	{
+		Sphere & particle = spheres[pairs[pair].first];
+		Sphere & neighbor = spheres[pairs[pair].second];
+		const Vector3D force( 1.0 / (pair + 3), std::sqrt(pair + 0.1), - 0.1 * pair );
+
+		particle.addContactForce(force);
+		neighbor.addContactForce(- force);
+		particle.addTorque(1.7 * force);
+		particle.setNormalForce(neighbor, force);
+	};
+
+	ThreadPool threadPool(1);
+	PairEvaluator evaluator(threadPool);
+	check(evaluator.isSerial());
+
+	evaluator.evaluate(pairs.size(), interact);
+	vector<Vector3D> serialForces(store.contactForceColumn(), store.contactForceColumn() + spheres.size());
+	vector<Vector3D> serialTorques(store.torqueColumn(), store.torqueColumn() + spheres.size());
+
+	// deterministic reduction is bit-identical to the serial run
+	threadPool.setNumberOfThreads(3);
+	store.resetForces();
+	evaluator.evaluate(pairs.size(), interact);
+	for(std::size_t i = 0; i < spheres.size(); ++i)
+	{
+		check(spheres[i].getContactForce() == serialForces[i]);
+		check(spheres[i].getResultingTorque() == serialTorques[i]);
+	}
+	check(spheres[0].getNormalForce(spheres[5]) == Vector3D( 1.0 / 7, std::sqrt(4 + 0.1), - 0.1 * 4 ));
+
+	// non-deterministic reduction only changes the rounding
+	evaluator.setDeterministic(false);
+	evaluator.track(store);
+	store.resetForces();
+	evaluator.evaluate(pairs.size(), interact);
+	for(std::size_t i = 0; i < spheres.size(); ++i)
+	{
+		for(std::size_t k = 0; k < 3; ++k)
+		{
+			checkClose(spheres[i].getContactForce()[k], serialForces[i][k], 1e-9);
+		}
+	}
+}
+
+TestCase(OutputField_Test)
 {
-	SimulationFileTree fileTree;
+	using Sphere = SphericalParticle<Mass, MomentOfInertia>;
+
+	Sphere sphere;
+	sphere.setTaylorOrder(3);
+	sphere.set<Mass>(2.0);
+	sphere.setPosition(1.0, 2.0, 3.0);
+	sphere.setVelocity(0.123456789, 0.0, -1.0);
+	sphere.setPositionDerivative(3, 7.0, 8.0, 9.0);
+
+	const vector<OutputField> fields = json::parse(R"([
+		"Position",
+		{"Name": "Velocity", "Precision": 3},
+		{"Name": "PositionMatrix", "TaylorOrders": [0, 3], "Type": "float32"},
+		"translationalEnergy"
+	])").get<vector<OutputField>>();
 
-	string currentDir = psin::currentDirectory();
-	string simulationName = "RohanSimulation";
+	checkEqual(fields[0].getComponents(3), 3);
+	checkEqual(fields[2].getComponents(3), 6);
+	checkEqual(fields[3].getComponents(3), 1);
+	checkEqual(fields[2].getType(), "float32");
 
-	string rootFolder = currentDir + "/root/";
-	psin::createDirectory(rootFolder);
-	check(fileTree.setProjectRootFolder(rootFolder));
-	checkEqual(fileTree.getProjectRootFolder(), rootFolder);
+	vector<double> values;
+	for(const OutputField & field : fields) append_output_field(field, sphere, values);
+	checkEqual(values.size(), 13);
+	checkEqual(values[3], 0.123);
+	checkEqual(values[11], 9.0);
+	checkClose(values[12], 0.5 * 2.0 * (0.123456789 * 0.123456789 + 1.0), 1e-12);
 
-	string inputFolder = rootFolder + "_input/";
-	psin::createDirectory(inputFolder);
-	check(fileTree.setInputFolder(inputFolder));
-	checkEqual(fileTree.getInputFolder(), inputFolder);
+	const json matrix = output_field_json(fields[2], sphere);
+	checkEqual(matrix.size(), 2);
+	checkEqual(matrix[1][0].get<double>(), 7.0);
 
-	string particleInputFolder = inputFolder + simulationName + "/";
-	psin::createDirectory(particleInputFolder);
-	check(fileTree.setParticleInputFolder(particleInputFolder));
-	checkEqual(fileTree.getParticleInputFolder(), particleInputFolder);
+	BOOST_CHECK_THROW(OutputField("Temperature"), std::runtime_error);
+	BOOST_CHECK_THROW(OutputField("Position").setTaylorOrders({0}), std::runtime_error);
+	BOOST_CHECK_THROW(fields[2].getComponents(2), std::runtime_error);
+}
 
-	string inputMainDataFilePath = particleInputFolder + "mainInfoInput.txt";
-	psin::deletePath(inputMainDataFilePath);
-	ofstream of1(inputMainDataFilePath);
-	check(fileTree.setInputMainDataFilePath(inputMainDataFilePath));
-	checkEqual(fileTree.getInputMainDataFilePath(), inputMainDataFilePath);
+TestCase(Profiler_Test)
+{
+	BasicProfiler<true> profiler;
+	for(int step = 0; step < 10; ++step)
+	{
+		{
+			auto phase = profiler.time("Predict");
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+		for(int call = 0; call < 2; ++call)
+		{
+			auto phase = profiler.time("Interaction", NamedType<SphericalParticle<>>::name, string("Plane"));
+		}
+		if(step % 5 == 0)
+		{
+			auto phase = profiler.time("Snapshot");
+		}
+		profiler.endStep();
+	}
+
+	const json report = profiler.report();
+	checkEqual(report.at("Steps"), 10);
+	checkEqual(report.at("Phases").size(), 3);
+
+	const json & predict = report.at("Phases")[0];
+	checkEqual(predict.at("Name"), "Predict");
+	checkEqual(predict.at("Calls"), 10);
+	check(predict.at("Total").get<double>() >= 10 * 100e-6);
+	check(predict.at("MinPerStep").get<double>() >= 100e-6);
+	check(predict.at("PercentilesPerStep").at("50").get<double>() >= predict.at("MinPerStep").get<double>());
+	check(predict.at("PercentilesPerStep").at("99").get<double>() <= predict.at("MaxPerStep").get<double>());
+
+	checkEqual(report.at("Phases")[1].at("Name"), "Interaction/SphericalParticle/Plane");
+	checkEqual(report.at("Phases")[1].at("Calls"), 20);
+	checkEqual(report.at("Phases")[1].at("Steps"), 10);
+	checkEqual(report.at("Phases")[2].at("Steps"), 2);
+
+	BasicProfiler<false> disabled;
+	disabled.time("Predict");
+	disabled.endStep();
+	checkEqual(disabled.report().size(), 0);
+}
+
+TestCase(InteractionStatistics_Test)
+{
+	InteractionStatistics statistics;
+	statistics.setNumberOfThreads(2);
+	statistics.setNumberOfParticles("Sphere", 4);
+
+	InteractionStatistics::Triplet & normal = statistics.triplet("Normal", "Sphere", "Sphere", true);
+	InteractionStatistics::Triplet & tangential = statistics.triplet("Tangential", "Sphere", "Sphere", true);
+	InteractionStatistics::Triplet & wall = statistics.triplet("Normal", "Sphere", "Wall", false);
+	checkEqual(&statistics.triplet("Normal", "Sphere", "Sphere", true), &normal);
+
+	// Step 1: spheres 0 and 1 touch, and sphere 2 touches the wall
+	for(unsigned thread = 0; thread < 2; ++thread)
+	{
+		normal.countCandidate(thread);
+		normal.countCandidate(thread);
+		tangential.countCandidate(thread);
+		wall.countCandidate(thread);
+	}
+	normal.countTouching(1, {0, 1});
+	tangential.countTouching(0, {0, 1});
+	wall.countTouching(0, {2, 0});
+	statistics.endStep();
 
-	string outputFolder = rootFolder + "_output/" + simulationName + "/";
-	check(fileTree.setOutputFolder(outputFolder));
-	checkEqual(fileTree.getOutputFolder(), outputFolder);
+	// Step 2: spheres 0 and 1 still touch, sphere 2 left the wall and touches sphere 3
+	normal.countTouching(0, {2, 3});
+	normal.countTouching(1, {0, 1});
+	statistics.endStep();
 
-	string numericalOutputFolder = rootFolder + "_output/" + simulationName + "/Numerical/";
-	check(fileTree.setNumericalOutputFolder(numericalOutputFolder));
-	checkEqual(fileTree.getNumericalOutputFolder(), numericalOutputFolder);
+	const json entry = statistics.collect();
+	checkEqual(entry.at("Steps"), 2);
 
-	string graphicalOutputFolder = rootFolder + "_output/" + simulationName + "/Graphical/";
-	check(fileTree.setGraphicalOutputFolder(graphicalOutputFolder));
-	checkEqual(fileTree.getGraphicalOutputFolder(), graphicalOutputFolder);
+	const json & normalCounters = entry.at("Interactions")[0];
+	checkEqual(normalCounters.at("Interaction"), "Normal");
+	checkEqual(normalCounters.at("CandidatePairs"), 4);
+	checkEqual(normalCounters.at("TouchingPairs"), 3);
+	check(normalCounters.count("ForceEvaluations") == 0);
+	checkEqual(normalCounters.at("ContactsStarted"), 2);
+	checkEqual(normalCounters.at("ContactsEnded"), 0);
+	checkEqual(entry.at("Interactions")[2].at("ContactsEnded"), 1);
 
-	string timeVectorFileName = "timeVector.txt";
-	check(fileTree.setTimeVectorOutputFileName(timeVectorFileName));
+	// Tangential forces act on the same contact as normal ones, which is counted once
+	checkEqual(entry.at("CoordinationNumbers"), json({0, 4}));
+	checkEqual(entry.at("MeanCoordinationNumber"), 1.0);
 
-	string timeVectorForPlotOutputFileName = "timeVectorForPlot.txt";
-	check(fileTree.setTimeVectorForPlotOutputFileName(timeVectorForPlotOutputFileName));
+	// Counters start over after each collect()
+	statistics.endStep();
+	const json next = statistics.collect();
+	checkEqual(next.at("Interactions")[0].at("ContactsEnded"), 2);
+	checkEqual(next.at("Interactions")[0].at("CandidatePairs"), 0);
+	checkEqual(next.at("CoordinationNumbers"), json({4}));
 }
 
 TestCase(CommandLineParser_Test)
@@ -447,6 +795,302 @@ TestCase(CommandLineParser_Test)
 	checkEqual(config3.second, CommandLineParser::parseArgvIntoSimulationRootPath(argc3, argv3));
 }
 
+namespace Simulation_restart_Test_namespace {
+	using RestartedSimulator = Simulator<
+		ParticleList< SphericalParticle<ElasticModulus, NormalDissipativeConstant> >,
+		BoundaryList<>,
+		InteractionList<NormalForceLinearDashpotForce>,
+		IntegratorList<GearIntegrator>,
+		SeekerList<BlindSeeker>
+	>;
+
+	json sphere(const string & name, const double x, const double u)
+	{
+		return json{
+			{"Name", name},
+			{"TaylorOrder", 4},
+			{"Mass", 1e-3},
+			{"Radius", 1e-2},
+			{"MomentOfInertia", 4e-8},
+			{"ElasticModulus", 1e5},
+			{"NormalDissipativeConstant", 1.0},
+			{"Position", {x, 0.0, 0.0}},
+			{"Velocity", {u, 0.0, 0.0}}
+		};
+	}
+
+	// Twenty steps, storing a frame every other step and writing every fourth one, with a checkpoint
+	// every six steps. The last checkpoint is at step 18, one frame after the last write.
+	json main_input(const path & outputFolder, const path & checkpointFile)
+	{
+		return json{
+			{"InitialInstant", 0.0},
+			{"TimeStep", 1e-3},
+			{"FinalInstant", 1.95e-2},
+			{"StepsForStoring", 2},
+			{"StoragesForWriting", 4},
+			{"IntegrationAlgorithm", "Gear"},
+			{"OutputFields", json::array({"Position", "Velocity"})},
+			{"CheckpointInterval", 6},
+			{"CheckpointFile", checkpointFile},
+			{"MainOutputFolder", outputFolder},
+			{"ParticleOutputFolder", outputFolder / path("particles")},
+			{"BoundaryOutputFolder", outputFolder / path("boundaries")},
+			{"Interactions", { {"NormalForceLinearDashpotForce", nullptr} }},
+			{"Particles", { {"SphericalParticle", json::array({ sphere("Left", -0.015, 0.1), sphere("Right", 0.015, -0.1) })} }}
+		};
+	}
+
+	void run(const json & mainInput)
+	{
+		RestartedSimulator simulator;
+		simulator.setup(mainInput);
+		simulator.createDirectories();
+		simulator.simulate();
+	}
+
+	// Throws unless the file holds a single JSON value
+	json read_output(const path & outputFolder, const path & filePath)
+	{
+		return read_json( (outputFolder / filePath).string() );
+	}
+} // Simulation_restart_Test_namespace
+
+TestCase(Simulation_restart_Test)
+{
+	using namespace Simulation_restart_Test_namespace;
+
+	const path folder = psin::filesystem::temp_directory_path() / path("SimulationLibTest_restart");
+	psin::filesystem::remove_all(folder);
+	const path checkpointFile = folder / path("checkpoint.bin");
+	const path fullFolder = folder / path("full");
+	const path restartedFolder = folder / path("restarted");
+
+	run( main_input(fullFolder, checkpointFile) );
+
+	json restartInput = main_input(restartedFolder, checkpointFile);
+	restartInput["RestartFrom"] = checkpointFile;
+	run(restartInput);
+
+	// The restarted run ends before it stores StoragesForWriting frames, so its only entry is
+	// written at the end of the simulation
+	const json fullTimes = read_output(fullFolder, path("timeVector.json"));
+	const json restartedTimes = read_output(restartedFolder, path("timeVector.json"));
+	checkEqual(fullTimes.size(), 10);
+	checkEqual(restartedTimes.size(), 1);
+	checkEqual(restartedTimes.front(), fullTimes.back());
+
+	for(const string name : {"Left", "Right"})
+	{
+		const json fullEntries = read_output(fullFolder, path("particles") / path(name + ".json"));
+		const json restartedEntries = read_output(restartedFolder, path("particles") / path(name + ".json"));
+		checkEqual(restartedEntries.size(), 1);
+		checkEqual(restartedEntries.front(), fullEntries.back());
+	}
+
+	// Restarting into folders that already hold output leaves them untouched
+	json overwritingInput = main_input(fullFolder, checkpointFile);
+	overwritingInput["RestartFrom"] = checkpointFile;
+	BOOST_CHECK_THROW( run(overwritingInput), std::runtime_error );
+	checkEqual(read_output(fullFolder, path("timeVector.json")), fullTimes);
+
+	psin::filesystem::remove_all(folder);
+}
+
+TestCase(Simulation_restart_particles_Test)
+{
+	using namespace Simulation_restart_Test_namespace;
+
+	const path folder = psin::filesystem::temp_directory_path() / path("SimulationLibTest_restart_particles");
+	psin::filesystem::remove_all(folder);
+	const path checkpointFile = folder / path("checkpoint.bin");
+
+	run( main_input(folder / path("full"), checkpointFile) );
+
+	json restartInput = main_input(folder / path("restarted"), checkpointFile);
+	restartInput["RestartFrom"] = checkpointFile;
+
+	// Both particles have the same state layout, so only their names tell them apart
+	json swapped = restartInput;
+	swapped["Particles"]["SphericalParticle"] = json::array({ sphere("Right", 0.015, -0.1), sphere("Left", -0.015, 0.1) });
+	BOOST_CHECK_THROW( run(swapped), std::runtime_error );
+
+	json missing = restartInput;
+	missing["Particles"]["SphericalParticle"] = json::array({ sphere("Left", -0.015, 0.1) });
+	BOOST_CHECK_THROW( run(missing), std::runtime_error );
+
+	json otherOrder = restartInput;
+	otherOrder["Particles"]["SphericalParticle"][1]["TaylorOrder"] = 3;
+	BOOST_CHECK_THROW( run(otherOrder), std::runtime_error );
+
+	psin::filesystem::remove_all(folder);
+}
+
+TestCase(Simulation_interaction_properties_Test)
+{
+	using namespace Simulation_restart_Test_namespace;
+
+	const path folder = psin::filesystem::temp_directory_path() / path("SimulationLibTest_interaction_properties");
+
+	json input = main_input(folder, folder / path("checkpoint.bin"));
+	input["Particles"]["SphericalParticle"][1].erase("NormalDissipativeConstant");
+
+	RestartedSimulator simulator;
+	BOOST_CHECK_THROW( simulator.setup(input), std::runtime_error );
+
+	// Nothing reads the missing property if the interaction is not used
+	input["Interactions"] = json::object();
+	RestartedSimulator otherSimulator;
+	otherSimulator.setup(input);
+}
+
+TestCase(Simulation_OutputByteBudget_Test)
+{
+	using namespace Simulation_restart_Test_namespace;
+
+	const path folder = psin::filesystem::temp_directory_path() / path("SimulationLibTest_budget");
+	psin::filesystem::remove_all(folder);
+	const path checkpointFile = folder / path("checkpoint.bin");
+	const path fullFolder = folder / path("full");
+	const path restartedFolder = folder / path("restarted");
+
+	// Every frame fills the output buffer, so that it is written long before StoragesForWriting
+	// frames are stored. The restarted run, from step 12, never stores that many.
+	auto budgetInput = [&checkpointFile](const path & outputFolder)
+	{
+		json j = main_input(outputFolder, checkpointFile);
+		j["StepsForStoring"] = 1;
+		j["StoragesForWriting"] = 10;
+		j["CheckpointInterval"] = 12;
+		j["OutputByteBudget"] = 1;
+		return j;
+	};
+
+	run( budgetInput(fullFolder) );
+
+	json restartInput = budgetInput(restartedFolder);
+	restartInput["RestartFrom"] = checkpointFile;
+	run(restartInput);
+
+	const json fullTimes = read_output(fullFolder, path("timeVector.json"));
+	const json restartedTimes = read_output(restartedFolder, path("timeVector.json"));
+	checkEqual(fullTimes.size(), 20);
+	checkEqual(restartedTimes.size(), 8);
+	checkEqual(restartedTimes, json(fullTimes.end() - 8, fullTimes.end()));
+
+	for(const string name : {"Left", "Right"})
+	{
+		const json fullEntries = read_output(fullFolder, path("particles") / path(name + ".json"));
+		const json restartedEntries = read_output(restartedFolder, path("particles") / path(name + ".json"));
+		checkEqual(fullEntries.size(), 20);
+		checkEqual(restartedEntries, json(fullEntries.end() - 8, fullEntries.end()));
+	}
+
+	psin::filesystem::remove_all(folder);
+}
+
+namespace Simulation_checkpoint_Test_namespace {
+	// Stops the simulation in the middle of a time step, as a crash would
+	struct CrashingForce
+	{
+		template<typename P1, typename P2>
+		struct check : mp::bool_constant< is_same<P1, P2>::value >
+		{};
+
+		static std::size_t crashIndex;
+
+		template<typename P1, typename P2, typename Time>
+		static void calculate(P1 &, P2 &, const Time & time)
+		{
+			if(time.getIndex() == crashIndex) throw std::runtime_error("Crash");
+		}
+	};
+
+	std::size_t CrashingForce::crashIndex = 0;
+
+	using CrashingSimulator = Simulator<
+		ParticleList< SphericalParticle<ElasticModulus, NormalDissipativeConstant> >,
+		BoundaryList<>,
+		InteractionList<NormalForceLinearDashpotForce, CrashingForce>,
+		IntegratorList<GearIntegrator>,
+		SeekerList<BlindSeeker>
+	>;
+
+	void run(const json & mainInput)
+	{
+		CrashingSimulator simulator;
+		simulator.setup(mainInput);
+		simulator.createDirectories();
+		simulator.simulate();
+	}
+
+	vector<json> read_lines(const path & filePath)
+	{
+		JsonLinesReader reader(filePath);
+		return reader.readAvailable();
+	}
+} // Simulation_checkpoint_Test_namespace
+
+namespace psin {
+	template<> const string NamedType<Simulation_checkpoint_Test_namespace::CrashingForce>::name = "CrashingForce";
+
+	template<>
+	void initializeInteraction<Simulation_checkpoint_Test_namespace::CrashingForce>(const json & j)
+	{}
+
+	template<>
+	void finalizeInteraction<Simulation_checkpoint_Test_namespace::CrashingForce>()
+	{}
+} // psin
+
+TestCase(Simulation_checkpoint_Test)
+{
+	using namespace Simulation_checkpoint_Test_namespace;
+
+	const path folder = psin::filesystem::temp_directory_path() / path("SimulationLibTest_checkpoint");
+	psin::filesystem::remove_all(folder);
+	const path checkpointFile = folder / path("checkpoint.bin");
+	const path fullFolder = folder / path("full");
+	const path crashedFolder = folder / path("crashed");
+	const path restartedFolder = folder / path("restarted");
+
+	// Frames are written at steps 6 and 14, and the checkpoint is written at step 12, while the
+	// frames of steps 8 and 10 are still waiting to be written. The run crashes at step 13.
+	auto checkpointInput = [&checkpointFile](const path & outputFolder)
+	{
+		json j = Simulation_restart_Test_namespace::main_input(outputFolder, checkpointFile);
+		j["CheckpointInterval"] = 12;
+		j["JsonLayout"] = "Lines";
+		return j;
+	};
+
+	run( checkpointInput(fullFolder) );
+
+	json crashInput = checkpointInput(crashedFolder);
+	crashInput["Interactions"]["CrashingForce"] = nullptr;
+	CrashingForce::crashIndex = 13;
+	BOOST_CHECK_THROW( run(crashInput), std::runtime_error );
+
+	json restartInput = checkpointInput(restartedFolder);
+	restartInput["RestartFrom"] = checkpointFile;
+	run(restartInput);
+
+	// The output of the crashed run, followed by the output of the run restarted from its
+	// checkpoint, is the output of the full run
+	for(const path filePath : {path("timeVector.jsonl"), path("particles") / path("Left.jsonl"), path("particles") / path("Right.jsonl")})
+	{
+		const vector<json> fullEntries = read_lines(fullFolder / filePath);
+		vector<json> entries = read_lines(crashedFolder / filePath);
+		checkEqual(entries.size(), 6);
+		const vector<json> restartedEntries = read_lines(restartedFolder / filePath);
+		entries.insert(entries.end(), restartedEntries.begin(), restartedEntries.end());
+		checkEqual(fullEntries.size(), 10);
+		check(entries == fullEntries);
+	}
+
+	psin::filesystem::remove_all(folder);
+}
+
 // TestCase(SimulateTest)
 // {
 // 	/*TO DO*/
@@ -0,0 +1,67 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+// Standard
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace psin {
+
+class Tracer;
+
+// ThreadPool keeps numberOfThreads - 1 worker threads alive between calls; the calling
+// thread takes part in every job, so a pool of one thread runs everything inline.
+class ThreadPool
+{
+	public:
+		explicit ThreadPool(const unsigned numberOfThreads = 1);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool &) = delete;
+		ThreadPool & operator=(const ThreadPool &) = delete;
+
+		void setNumberOfThreads(const unsigned numberOfThreads); // throws
+		unsigned getNumberOfThreads() const;
+
+		// With a tracer, each thread's share of a job run during a traced step is recorded as a "Task"
+		void setTracer(Tracer * tracer);
+
+		// Runs task(threadIndex) once on every thread and waits for all of them. If any of them
+		// throws, the first exception is rethrown on the calling thread once all of them are done.
+		void run(const std::function<void(unsigned)> & task);
+
+		// Splits [0, size) into one contiguous block per thread and calls function(begin, end) for each
+		template<typename Function>
+		void parallel_for(const std::size_t size, Function && function);
+
+	private:
+		void startWorkers(const unsigned numberOfWorkers);
+		void stopWorkers();
+		void work(const unsigned threadIndex, unsigned long lastJob);
+		void keepError(const std::exception_ptr & error);
+
+		std::vector<std::thread> workers;
+
+		std::mutex mutex;
+		std::condition_variable jobStarted;
+		std::condition_variable jobFinished;
+
+		const std::function<void(unsigned)> * job = nullptr;
+		unsigned long jobCount = 0;
+		unsigned runningWorkers = 0;
+		bool stopping = false;
+		std::exception_ptr error;	// the first one thrown during the current job
+
+		Tracer * tracer = nullptr;
+};
+
+} // psin
+
+#include <ThreadPool.tpp>
+
+#endif // THREAD_POOL_HPP
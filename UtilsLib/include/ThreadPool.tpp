@@ -0,0 +1,28 @@
+#ifndef THREAD_POOL_TPP
+#define THREAD_POOL_TPP
+
+namespace psin {
+
+template<typename Function>
+void ThreadPool::parallel_for(const std::size_t size, Function && function)
+{
+	const std::size_t numberOfThreads = this->getNumberOfThreads();
+
+	if(numberOfThreads == 1 or size < numberOfThreads)
+	{
+		function(std::size_t(0), size);
+	}
+	else
+	{
+		this->run([&](const unsigned threadIndex)
+		{
+			const std::size_t begin = size * threadIndex / numberOfThreads;
+			const std::size_t end = size * (threadIndex + 1) / numberOfThreads;
+			function(begin, end);
+		});
+	}
+}
+
+} // psin
+
+#endif // THREAD_POOL_TPP
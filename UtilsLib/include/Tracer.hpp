@@ -0,0 +1,131 @@
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+// UtilsLib
+#include <FileSystem.hpp>
+#include <string.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// Standard
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace psin {
+
+// Tracer records when scopes of code begin and end, on every thread that opens one, and writes
+// them as a Chrome trace_event file, which chrome://tracing and Perfetto open as a timeline.
+//
+// Only every interval-th step is traced: beginStep() decides whether the step it starts is, and
+// scopes opened during other steps record nothing. An interval of 0, the default, disables tracing.
+//
+// Each thread records into a ring buffer of its own, which no other thread writes to, so that
+// recording takes no lock. When a buffer is full, its oldest events are overwritten. Buffers are
+// only read by write(), which must not run while other threads are recording.
+class Tracer
+{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		constexpr static std::size_t defaultCapacity = 1 << 16;
+
+		// A scope of code which began and ended on a thread. name must outlive the tracer, as
+		// string literals do.
+		struct Event
+		{
+			const char * name;
+			Clock::time_point begin;
+			Clock::time_point end;
+			long step;
+		};
+
+		// Scope records an event from its construction to its destruction
+		class Scope
+		{
+			public:
+				Scope() = default;
+				Scope(Tracer & tracer, const char * name);
+				Scope(Scope && other);
+				~Scope();
+
+				Scope(const Scope &) = delete;
+				Scope & operator=(const Scope &) = delete;
+				Scope & operator=(Scope &&) = delete;
+
+			private:
+				Tracer * tracer = nullptr;
+				const char * name;
+				Clock::time_point begin;
+				long step;
+		};
+
+		Tracer();
+		~Tracer();
+
+		Tracer(const Tracer &) = delete;
+		Tracer & operator=(const Tracer &) = delete;
+
+		void setInterval(const std::size_t interval);
+		std::size_t getInterval() const;
+		bool isEnabled() const;
+
+		// Events kept per thread. Must be set before anything is recorded.
+		void setCapacity(const std::size_t capacity); // throws
+		std::size_t getCapacity() const;
+
+		// Starts step, which is traced if it is a multiple of the interval
+		void beginStep(const long step);
+		bool isActive() const;
+
+		// Does nothing unless the current step is traced. Unsampled scopes are recorded in every
+		// step while tracing is enabled, for rare events such as output flushes.
+		Scope scope(const char * name);
+		Scope unsampledScope(const char * name);
+
+		// Names the calling thread in the timeline
+		void nameThread(const string & name);
+
+		// Events kept in the buffers, and events overwritten because a buffer was full
+		std::size_t getNumberOfEvents() const;
+		std::size_t getNumberOfDroppedEvents() const;
+
+		json trace() const;
+		void write(const path & filePath) const; // throws
+
+	private:
+		struct Buffer
+		{
+			std::vector<Event> events;
+			std::atomic<std::size_t> count{0};	// of events ever recorded
+			string name;
+			unsigned threadIndex;
+			std::thread::id threadId;
+		};
+
+		Buffer & buffer();
+		void record(const Event & event);
+
+		std::size_t interval = 0;
+		std::size_t capacity = defaultCapacity;
+		std::atomic<bool> active{false};
+		std::atomic<long> step{0};
+
+		// Told apart from every other tracer, even one which reuses its address, by the thread-local
+		// cache of buffers
+		const std::uint64_t id;
+		const Clock::time_point origin;
+
+		mutable std::mutex mutex;
+		std::vector< std::unique_ptr<Buffer> > buffers;
+};
+
+} // psin
+
+#endif // TRACER_HPP
@@ -0,0 +1,161 @@
+#include <ThreadPool.hpp>
+
+// UtilsLib
+#include <Tracer.hpp>
+
+// Standard
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace psin {
+
+ThreadPool::ThreadPool(const unsigned numberOfThreads)
+{
+	this->setNumberOfThreads(numberOfThreads);
+}
+
+ThreadPool::~ThreadPool()
+{
+	this->stopWorkers();
+}
+
+void ThreadPool::setNumberOfThreads(const unsigned numberOfThreads)
+{
+	if(numberOfThreads == 0)
+	{
+		throw std::runtime_error("The number of threads must be positive.");
+	}
+
+	if(numberOfThreads != this->getNumberOfThreads())
+	{
+		this->stopWorkers();
+		this->startWorkers(numberOfThreads - 1);
+	}
+}
+
+unsigned ThreadPool::getNumberOfThreads() const
+{
+	return static_cast<unsigned>(this->workers.size()) + 1;
+}
+
+void ThreadPool::setTracer(Tracer * tracer)
+{
+	this->tracer = tracer;
+}
+
+void ThreadPool::run(const std::function<void(unsigned)> & task)
+{
+	if(this->workers.empty())
+	{
+		task(0);
+		return;
+	}
+
+	std::function<void(unsigned)> tracedTask;
+	if(this->tracer and this->tracer->isActive())
+	{
+		tracedTask = [&task, this](const unsigned threadIndex)
+		{
+			if(threadIndex > 0) this->tracer->nameThread("Worker " + std::to_string(threadIndex));
+			auto event = this->tracer->scope("Task");
+			task(threadIndex);
+		};
+	}
+	const std::function<void(unsigned)> & job = tracedTask ? tracedTask : task;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->job = &job;
+		this->runningWorkers = static_cast<unsigned>(this->workers.size());
+		this->error = nullptr;
+		++this->jobCount;
+	}
+	this->jobStarted.notify_all();
+
+	// The workers run job, which lives in this frame, so they are waited for even if it throws here
+	try
+	{
+		job(0);
+	}
+	catch(...)
+	{
+		this->keepError(std::current_exception());
+	}
+
+	std::exception_ptr error;
+	{
+		std::unique_lock<std::mutex> lock(this->mutex);
+		this->jobFinished.wait(lock, [this]{ return this->runningWorkers == 0; });
+		this->job = nullptr;
+		std::swap(error, this->error);
+	}
+	if(error) std::rethrow_exception(error);
+}
+
+void ThreadPool::keepError(const std::exception_ptr & error)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	if(not this->error) this->error = error;
+}
+
+void ThreadPool::startWorkers(const unsigned numberOfWorkers)
+{
+	this->stopping = false;
+	for(unsigned worker = 0; worker < numberOfWorkers; ++worker)
+	{
+		this->workers.emplace_back(&ThreadPool::work, this, worker + 1, this->jobCount);
+	}
+}
+
+void ThreadPool::stopWorkers()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->stopping = true;
+	}
+	this->jobStarted.notify_all();
+
+	for(auto& worker : this->workers)
+	{
+		worker.join();
+	}
+	this->workers.clear();
+}
+
+// lastJob is the job count when the worker was started, so that a job posted before the
+// thread gets to run is not missed
+void ThreadPool::work(const unsigned threadIndex, unsigned long lastJob)
+{
+	while(true)
+	{
+		const std::function<void(unsigned)> * task;
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->jobStarted.wait(lock, [&, this]{ return this->stopping or this->jobCount != lastJob; });
+
+			if(this->stopping) return;
+
+			lastJob = this->jobCount;
+			task = this->job;
+		}
+
+		try
+		{
+			(*task)(threadIndex);
+		}
+		catch(...)
+		{
+			this->keepError(std::current_exception());
+		}
+
+		bool last;
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			last = (--this->runningWorkers == 0);
+		}
+		if(last) this->jobFinished.notify_one();
+	}
+}
+
+} // psin
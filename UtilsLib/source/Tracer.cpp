@@ -0,0 +1,251 @@
+#include <Tracer.hpp>
+
+// Standard
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace psin {
+
+namespace {
+
+std::atomic<std::uint64_t> nextTracerId{1};
+
+// The buffer the calling thread last recorded into, and the tracer owning it
+struct CachedBuffer
+{
+	std::uint64_t tracer = 0;
+	void * buffer = nullptr;
+};
+
+thread_local CachedBuffer cachedBuffer;
+
+double microseconds(const Tracer::Clock::duration duration)
+{
+	return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+} // anonymous namespace
+
+Tracer::Scope::Scope(Tracer & tracer, const char * name)
+	: tracer(&tracer),
+	name(name),
+	begin(Clock::now()),
+	step(tracer.step.load(std::memory_order_relaxed))
+{}
+
+Tracer::Scope::Scope(Scope && other)
+	: tracer(other.tracer),
+	name(other.name),
+	begin(other.begin),
+	step(other.step)
+{
+	other.tracer = nullptr;
+}
+
+Tracer::Scope::~Scope()
+{
+	if(this->tracer) this->tracer->record( Event{this->name, this->begin, Clock::now(), this->step} );
+}
+
+Tracer::Tracer()
+	: id(nextTracerId++),
+	origin(Clock::now())
+{}
+
+Tracer::~Tracer() = default;
+
+void Tracer::setInterval(const std::size_t interval)
+{
+	this->interval = interval;
+	if(interval == 0) this->active.store(false, std::memory_order_relaxed);
+}
+
+std::size_t Tracer::getInterval() const
+{
+	return this->interval;
+}
+
+bool Tracer::isEnabled() const
+{
+	return this->interval > 0;
+}
+
+void Tracer::setCapacity(const std::size_t capacity)
+{
+	if(capacity == 0)
+	{
+		throw std::runtime_error("The trace capacity must be positive.");
+	}
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	if(not this->buffers.empty())
+	{
+		throw std::runtime_error("The trace capacity must be set before anything is traced.");
+	}
+	this->capacity = capacity;
+}
+
+std::size_t Tracer::getCapacity() const
+{
+	return this->capacity;
+}
+
+void Tracer::beginStep(const long step)
+{
+	this->step.store(step, std::memory_order_relaxed);
+	this->active.store(this->interval > 0 and step % static_cast<long>(this->interval) == 0, std::memory_order_relaxed);
+}
+
+bool Tracer::isActive() const
+{
+	return this->active.load(std::memory_order_relaxed);
+}
+
+Tracer::Scope Tracer::scope(const char * name)
+{
+	if(this->isActive()) return Scope(*this, name);
+	return Scope();
+}
+
+Tracer::Scope Tracer::unsampledScope(const char * name)
+{
+	if(this->isEnabled()) return Scope(*this, name);
+	return Scope();
+}
+
+void Tracer::nameThread(const string & name)
+{
+	Buffer & buffer = this->buffer();
+	if(buffer.name != name)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		buffer.name = name;
+	}
+}
+
+// A thread looks its buffer up under the lock only the first time it records into this tracer,
+// or when it last recorded into another one
+Tracer::Buffer & Tracer::buffer()
+{
+	if(cachedBuffer.tracer == this->id) return *static_cast<Buffer *>(cachedBuffer.buffer);
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	const std::thread::id threadId = std::this_thread::get_id();
+	Buffer * found = nullptr;
+	for(const auto& buffer : this->buffers)
+	{
+		if(buffer->threadId == threadId) found = buffer.get();
+	}
+	if(not found)
+	{
+		this->buffers.push_back( std::make_unique<Buffer>() );
+		found = this->buffers.back().get();
+		found->events.resize(this->capacity);
+		found->threadIndex = static_cast<unsigned>(this->buffers.size() - 1);
+		found->threadId = threadId;
+		found->name = "Thread " + std::to_string(found->threadIndex);
+	}
+
+	cachedBuffer.tracer = this->id;
+	cachedBuffer.buffer = found;
+	return *found;
+}
+
+// Only the buffer's own thread writes to it: the count is published after the event, so that
+// a reader which sees the count also sees the event
+void Tracer::record(const Event & event)
+{
+	Buffer & buffer = this->buffer();
+	const std::size_t count = buffer.count.load(std::memory_order_relaxed);
+	buffer.events[count % this->capacity] = event;
+	buffer.count.store(count + 1, std::memory_order_release);
+}
+
+std::size_t Tracer::getNumberOfEvents() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	std::size_t events = 0;
+	for(const auto& buffer : this->buffers)
+	{
+		events += std::min(buffer->count.load(std::memory_order_acquire), this->capacity);
+	}
+	return events;
+}
+
+std::size_t Tracer::getNumberOfDroppedEvents() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	std::size_t dropped = 0;
+	for(const auto& buffer : this->buffers)
+	{
+		const std::size_t count = buffer->count.load(std::memory_order_acquire);
+		if(count > this->capacity) dropped += count - this->capacity;
+	}
+	return dropped;
+}
+
+// Events are written as complete ("X") events, each one holding the beginning and the end of a
+// scope, so that overwriting the oldest ones never leaves a beginning without its end. Times are
+// in microseconds since the tracer was built.
+json Tracer::trace() const
+{
+	const std::size_t dropped = this->getNumberOfDroppedEvents();
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	json events = json::array();
+	for(const auto& buffer : this->buffers)
+	{
+		events.push_back(json{
+			{"name", "thread_name"},
+			{"ph", "M"},
+			{"pid", 0},
+			{"tid", buffer->threadIndex},
+			{"args", { {"name", buffer->name} }}
+		});
+
+		const std::size_t count = buffer->count.load(std::memory_order_acquire);
+		const std::size_t first = count > this->capacity ? count - this->capacity : 0;
+		for(std::size_t i = first; i < count; ++i)
+		{
+			const Event & event = buffer->events[i % this->capacity];
+			events.push_back(json{
+				{"name", event.name},
+				{"cat", "psin"},
+				{"ph", "X"},
+				{"ts", microseconds(event.begin - this->origin)},
+				{"dur", microseconds(event.end - event.begin)},
+				{"pid", 0},
+				{"tid", buffer->threadIndex},
+				{"args", { {"step", event.step} }}
+			});
+		}
+	}
+
+	return json{
+		{"traceEvents", events},
+		{"displayTimeUnit", "ms"},
+		{"otherData", {
+			{"Clock", "steady_clock"},
+			{"Interval", this->interval},
+			{"Capacity", this->capacity},
+			{"DroppedEvents", dropped}
+		}}
+	};
+}
+
+void Tracer::write(const path & filePath) const
+{
+	std::ofstream file(filePath.string());
+	if(not file)
+	{
+		throw std::runtime_error("Could not open " + filePath.string() + " to write the trace.");
+	}
+	file << this->trace().dump() << std::endl;
+}
+
+} // psin
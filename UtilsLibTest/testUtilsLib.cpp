@@ -1,6 +1,11 @@
 #define BOOST_TEST_MODULE TestModule
 
 // Standard
+#include <chrono>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 
@@ -16,6 +21,8 @@
 #include <SharedPointer.hpp>
 #include <string.hpp>
 #include <Test.hpp>
+#include <ThreadPool.hpp>
+#include <Tracer.hpp>
 #include <UniquePointer.hpp>
 #include <Variant.hpp>
 #include <Vector.hpp>
@@ -276,7 +283,7 @@ TestCase(vector_erase_Test)
 	checkEqual(v.size(), 3);
 
 	v.erase(v.begin(), v.end());
-	checkEqual(v.size(), 3);
+	checkEqual(v.size(), 0);
 }
 
 // ----- Vector3D -----
@@ -1778,4 +1785,142 @@ TestCase(reciprocalOfSumOfReciprocals_Test)
 	checkEqual(reciprocalOfSumOfReciprocals(10, 0), 10);
 	checkEqual(reciprocalOfSumOfReciprocals(0, 10), 10);
 	checkEqual(reciprocalOfSumOfReciprocals(4, 6), 2.4);
+}
+
+TestCase(ThreadPool_Test)
+{
+	ThreadPool pool(3);
+	checkEqual(pool.getNumberOfThreads(), 3);
+
+	std::vector<int> visits(1000, 0);
+	for(int repetition = 0; repetition < 5; ++repetition)
+	{
+		pool.parallel_for(visits.size(), [&](const std::size_t begin, const std::size_t end)
+		{
+			for(std::size_t i = begin; i < end; ++i) ++visits[i];
+		});
+	}
+	for(const int visit : visits) checkEqual(visit, 5);
+
+	std::vector<int> threadIndices(3, -1);
+	pool.run([&](const unsigned threadIndex){ threadIndices[threadIndex] = threadIndex; });
+	checkEqual(threadIndices[0], 0);
+	checkEqual(threadIndices[1], 1);
+	checkEqual(threadIndices[2], 2);
+
+	pool.setNumberOfThreads(1);
+	checkEqual(pool.getNumberOfThreads(), 1);
+
+	bool ranInline = false;
+	pool.run([&](const unsigned threadIndex){ ranInline = (threadIndex == 0); });
+	check(ranInline);
+
+	BOOST_CHECK_THROW(pool.setNumberOfThreads(0), std::runtime_error);
+}
+
+TestCase(ThreadPool_exception_Test)
+{
+	ThreadPool pool(4);
+
+	// Whichever thread throws, the others finish their share before run rethrows
+	for(unsigned thrower = 0; thrower < 4; ++thrower)
+	{
+		std::vector<int> finished(4, 0);
+		BOOST_CHECK_THROW(
+			pool.run([&](const unsigned threadIndex)
+			{
+				if(threadIndex == thrower) throw std::runtime_error("Task failed");
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				finished[threadIndex] = 1;
+			}),
+			std::runtime_error
+		);
+		for(unsigned threadIndex = 0; threadIndex < 4; ++threadIndex)
+		{
+			checkEqual(finished[threadIndex], threadIndex == thrower ? 0 : 1);
+		}
+	}
+
+	BOOST_CHECK_THROW(
+		pool.run([](const unsigned){ throw std::runtime_error("Every task failed"); }),
+		std::runtime_error
+	);
+
+	// The pool keeps working after a failed job
+	std::vector<int> visits(100, 0);
+	pool.parallel_for(visits.size(), [&](const std::size_t begin, const std::size_t end)
+	{
+		for(std::size_t i = begin; i < end; ++i) ++visits[i];
+	});
+	for(const int visit : visits) checkEqual(visit, 1);
+}
+
+TestCase(Tracer_Test)
+{
+	Tracer disabled;
+	check(not disabled.isEnabled());
+	disabled.beginStep(0);
+	{
+		auto event = disabled.scope("Step");
+		auto unsampled = disabled.unsampledScope("Export");
+	}
+	checkEqual(disabled.getNumberOfEvents(), 0);
+
+	Tracer tracer;
+	tracer.setInterval(2);
+	tracer.nameThread("Main");
+
+	ThreadPool pool(3);
+	pool.setTracer(&tracer);
+
+	// Steps 0 and 2 are traced: a step, and a task on each of the pool's threads
+	for(long step = 0; step < 4; ++step)
+	{
+		tracer.beginStep(step);
+		checkEqual(tracer.isActive(), step % 2 == 0);
+
+		auto event = tracer.scope("Step");
+		pool.run([](const unsigned){});
+	}
+	{
+		auto unsampled = tracer.unsampledScope("Export");
+	}
+	checkEqual(tracer.getNumberOfEvents(), 2 * (1 + 3) + 1);
+	checkEqual(tracer.getNumberOfDroppedEvents(), 0);
+
+	const json trace = tracer.trace();
+	std::map<string, int> counts;
+	std::set<int> threads;
+	string mainThread;
+	for(const json & event : trace.at("traceEvents"))
+	{
+		if(event.at("ph") == "M")
+		{
+			if(event.at("tid") == 0) mainThread = event.at("args").at("name");
+			continue;
+		}
+		checkEqual(event.at("ph").get<string>(), "X");
+		check(event.at("dur").get<double>() >= 0.0);
+		++counts[event.at("name").get<string>()];
+		threads.insert(event.at("tid").get<int>());
+	}
+	checkEqual(mainThread, "Main");
+	checkEqual(counts["Step"], 2);
+	checkEqual(counts["Task"], 6);
+	checkEqual(counts["Export"], 1);
+	checkEqual(threads.size(), 3);
+
+	// A full buffer keeps the latest events
+	Tracer small;
+	small.setCapacity(4);
+	small.setInterval(1);
+	for(long step = 0; step < 10; ++step)
+	{
+		small.beginStep(step);
+		auto event = small.scope("Step");
+	}
+	checkEqual(small.getNumberOfEvents(), 4);
+	checkEqual(small.getNumberOfDroppedEvents(), 6);
+	checkEqual(small.trace().at("traceEvents").back().at("args").at("step").get<long>(), 9);
+	BOOST_CHECK_THROW(small.setCapacity(8), std::runtime_error);
 }
\ No newline at end of file
@@ -35,6 +35,7 @@ int main(int argc, char* argv[])
 	desc.add_options()
 		("help", "produce help message")
 		("path", program_options::value<string>(), "Project's root folder")
+		("threads", program_options::value<unsigned>(), "Number of threads; overrides main.json's NumberOfThreads")
 	;
 	program_options::variables_map vm = psin::parseCommandLine(
 			argc, 
@@ -89,7 +90,7 @@ int main(int argc, char* argv[])
 		
 	using IntegratorList = psin::IntegratorList<GearIntegrator>;
 
-	using SeekerList = psin::SeekerList<BlindSeeker>;
+	using SeekerList = psin::SeekerList<BlindSeeker, GridSeeker, VerletSeeker>;
 	
 	Simulator<
 		ParticleList,
@@ -102,6 +103,10 @@ int main(int argc, char* argv[])
 	std::cout << "\nmainInputFilePath: " << mainInputFilePath.string() << std::endl; // DEBUG
 
 	simulator.setup( mainInputFilePath );
+	if(vm.count("threads"))
+	{
+		simulator.setNumberOfThreads( vm["threads"].as<unsigned>() );
+	}
 	simulator.outputMainData();
 	simulator.backupInteractions();
 	simulator.backupParticles();
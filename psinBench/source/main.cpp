@@ -0,0 +1,514 @@
+// UtilsLib
+#include <FileSystem.hpp>
+#include <string.hpp>
+
+// PropertyLib
+#include <PropertyDefinitions.hpp>
+
+// EntityLib
+#include <FixedInfinitePlane.hpp>
+#include <GravityField.hpp>
+#include <SphericalParticle.hpp>
+
+// InteractionLib
+#include <InteractionDefinitions.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// SimulationLib
+#include <ProgramOptions.hpp>
+#include <Simulator.hpp>
+
+// Standard
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace psin;
+
+// psinBench times the whole Simulator pipeline on synthetic scenes built in memory, so that
+// its results depend only on the scene, its number of particles and the machine. Phase times
+// come from the profile.json written by the simulation, which is why this target is always
+// compiled with PSIN_PROFILING.
+namespace {
+
+using ParticleList = psin::ParticleList<
+	SphericalParticle<
+		Mass,
+		MomentOfInertia,
+		ElasticModulus,
+		NormalDissipativeConstant,
+		TangentialDamping,
+		FrictionParameter,
+		ElectricCharge
+		>
+	>;
+
+using BoundaryList = psin::BoundaryList<
+	FixedInfinitePlane<
+		ElasticModulus,
+		NormalDissipativeConstant
+		>,
+	GravityField
+	>;
+
+using InteractionList = psin::InteractionList<
+	ElectrostaticForce,
+	NormalForceLinearDashpotForce,
+	TangentialForceHaffWerner,
+	GravityForce
+	>;
+
+using BenchSimulator = Simulator<
+	ParticleList,
+	BoundaryList,
+	InteractionList,
+	psin::IntegratorList<GearIntegrator>,
+	psin::SeekerList<GridSeeker, VerletSeeker, BlindSeeker>
+	>;
+
+constexpr double pi = 3.14159265358979323846;
+
+// Particles are 2 cm glass beads. With a contact stiffness of 1e5 N/m, a collision lasts about
+// a millisecond, which the time step resolves in a hundred steps.
+constexpr double radius = 0.01;
+constexpr double density = 2500.0;
+constexpr double stiffness = 1e5;
+constexpr double normalDissipation = 10.0;
+constexpr double timeStep = 1e-5;
+constexpr double gravity = 9.81;
+
+// Charges are large enough for neighbors in the charged cloud to pull each other as hard as gravity would
+constexpr double charge = 1e-7;
+
+struct Scene
+{
+	string name;
+	string description;
+	// Sizes above it are only run when asked for explicitly
+	std::size_t maxDefaultSize;
+	// Builds the "Particles", "Boundaries" and "Interactions" of a main input
+	json (*build)(const std::size_t numberOfParticles, std::mt19937 & random);
+};
+
+json vector_json(const double x, const double y, const double z)
+{
+	return json::array({x, y, z});
+}
+
+json particle_json(const std::size_t index, const json & position, const json & velocity)
+{
+	const double mass = density * 4.0 / 3.0 * pi * radius * radius * radius;
+
+	return json{
+		{"Name", "P" + std::to_string(index)},
+		{"TaylorOrder", 4},
+		{"Mass", mass},
+		{"Radius", radius},
+		{"MomentOfInertia", 2.0 / 5.0 * mass * radius * radius},
+		{"ElasticModulus", stiffness},
+		{"NormalDissipativeConstant", normalDissipation},
+		{"TangentialDamping", normalDissipation},
+		{"FrictionParameter", 0.5},
+		{"ElectricCharge", 0.0},
+		{"Position", position},
+		{"Velocity", velocity}
+	};
+}
+
+json plane_json(const string & name, const json & origin, const json & normalVector)
+{
+	return json{
+		{"Name", name},
+		{"ElasticModulus", stiffness},
+		{"NormalDissipativeConstant", normalDissipation},
+		{"origin", origin},
+		{"normalVector", normalVector}
+	};
+}
+
+json gravity_json()
+{
+	return json::array({ json{ {"Name", "Gravity"}, {"Gravity", vector_json(0.0, 0.0, -gravity)} } });
+}
+
+// Edge of a cube in which numberOfParticles particles fill the given fraction of the volume
+double box_edge(const std::size_t numberOfParticles, const double packingFraction)
+{
+	return std::cbrt(numberOfParticles * 4.0 / 3.0 * pi * radius * radius * radius / packingFraction);
+}
+
+// Particles at random places in a box of edge L, moving in random directions
+json random_cloud(const std::size_t numberOfParticles, const double L, const double speed, std::mt19937 & random)
+{
+	std::uniform_real_distribution<double> place(radius, L - radius);
+	std::uniform_real_distribution<double> velocity(-speed, speed);
+
+	json particles = json::array();
+	for(std::size_t i = 0; i < numberOfParticles; ++i)
+	{
+		const double x = place(random);
+		const double y = place(random);
+		const double z = place(random);
+		const double vx = velocity(random);
+		const double vy = velocity(random);
+		const double vz = velocity(random);
+		particles.push_back( particle_json(i, vector_json(x, y, z), vector_json(vx, vy, vz)) );
+	}
+	return particles;
+}
+
+// Dilute granular gas in a closed box, without gravity
+json build_gas(const std::size_t numberOfParticles, std::mt19937 & random)
+{
+	const double L = box_edge(numberOfParticles, 0.05);
+
+	json walls = json::array({
+		plane_json("Left", vector_json(0, 0, 0), vector_json(1, 0, 0)),
+		plane_json("Right", vector_json(L, 0, 0), vector_json(-1, 0, 0)),
+		plane_json("Front", vector_json(0, 0, 0), vector_json(0, 1, 0)),
+		plane_json("Back", vector_json(0, L, 0), vector_json(0, -1, 0)),
+		plane_json("Bottom", vector_json(0, 0, 0), vector_json(0, 0, 1)),
+		plane_json("Top", vector_json(0, 0, L), vector_json(0, 0, -1))
+	});
+
+	return json{
+		{"Particles", { {"SphericalParticle", random_cloud(numberOfParticles, L, 1.0, random)} }},
+		{"Boundaries", { {"FixedInfinitePlane", walls} }},
+		{"Interactions", { {"NormalForceLinearDashpotForce", nullptr}, {"TangentialForceHaffWerner", nullptr} }}
+	};
+}
+
+// Particles at rest on a square lattice, each layer resting on the one below and the lowest
+// one on the floor. Neighbors overlap by about their weight over the stiffness, so that
+// every particle keeps its six contacts.
+json build_bed(const std::size_t numberOfParticles, std::mt19937 &)
+{
+	const std::size_t layers = static_cast<std::size_t>( std::ceil(std::cbrt(numberOfParticles)) );
+	const std::size_t side = static_cast<std::size_t>( std::ceil(std::sqrt(double(numberOfParticles) / layers)) );
+	const double spacing = 2.0 * radius * (1.0 - 1e-4);
+
+	json particles = json::array();
+	for(std::size_t i = 0; i < numberOfParticles; ++i)
+	{
+		const double x = (i % side) * spacing;
+		const double y = (i / side % side) * spacing;
+		const double z = spacing / 2.0 + (i / (side * side)) * spacing;
+		particles.push_back( particle_json(i, vector_json(x, y, z), vector_json(0, 0, 0)) );
+	}
+
+	return json{
+		{"Particles", { {"SphericalParticle", particles} }},
+		{"Boundaries", {
+			{"FixedInfinitePlane", json::array({ plane_json("Floor", vector_json(0, 0, 0), vector_json(0, 0, 1)) })},
+			{"GravityField", gravity_json()}
+		}},
+		{"Interactions", { {"NormalForceLinearDashpotForce", nullptr}, {"TangentialForceHaffWerner", nullptr}, {"GravityForce", nullptr} }}
+	};
+}
+
+// A loose lattice falling into a V-shaped hopper of two planes at 45 degrees, between two walls
+json build_hopper(const std::size_t numberOfParticles, std::mt19937 & random)
+{
+	const std::size_t layers = static_cast<std::size_t>( std::ceil(std::cbrt(numberOfParticles)) );
+	const std::size_t side = static_cast<std::size_t>( std::ceil(std::sqrt(double(numberOfParticles) / layers)) );
+	const double spacing = 2.5 * radius;
+	const double width = side * spacing;
+
+	// The lowest layer is above both planes, so that every particle starts inside the hopper
+	const double bottom = width / 2.0 + 2.0 * radius;
+
+	std::uniform_real_distribution<double> jitter(-0.1 * radius, 0.1 * radius);
+
+	json particles = json::array();
+	for(std::size_t i = 0; i < numberOfParticles; ++i)
+	{
+		const double x = (i % side) * spacing - width / 2.0 + spacing / 2.0 + jitter(random);
+		const double y = (i / side % side) * spacing + spacing / 2.0;
+		const double z = bottom + (i / (side * side)) * spacing;
+		particles.push_back( particle_json(i, vector_json(x, y, z), vector_json(0, 0, 0)) );
+	}
+
+	const double s = std::sqrt(0.5);
+	json planes = json::array({
+		plane_json("LeftSlope", vector_json(0, 0, 0), vector_json(s, 0, s)),
+		plane_json("RightSlope", vector_json(0, 0, 0), vector_json(-s, 0, s)),
+		plane_json("Front", vector_json(0, 0, 0), vector_json(0, 1, 0)),
+		plane_json("Back", vector_json(0, width, 0), vector_json(0, -1, 0))
+	});
+
+	return json{
+		{"Particles", { {"SphericalParticle", particles} }},
+		{"Boundaries", {
+			{"FixedInfinitePlane", planes},
+			{"GravityField", gravity_json()}
+		}},
+		{"Interactions", { {"NormalForceLinearDashpotForce", nullptr}, {"TangentialForceHaffWerner", nullptr}, {"GravityForce", nullptr} }}
+	};
+}
+
+// A free cloud of particles of alternating charges. ElectrostaticForce acts on every pair of
+// particles, whichever the seeker, so each step costs O(N^2).
+json build_charged_cloud(const std::size_t numberOfParticles, std::mt19937 & random)
+{
+	json particles = random_cloud(numberOfParticles, box_edge(numberOfParticles, 0.01), 0.1, random);
+	for(std::size_t i = 0; i < numberOfParticles; ++i)
+	{
+		particles[i]["ElectricCharge"] = (i % 2 == 0) ? charge : -charge;
+	}
+
+	return json{
+		{"Particles", { {"SphericalParticle", particles} }},
+		{"Interactions", { {"ElectrostaticForce", nullptr}, {"NormalForceLinearDashpotForce", nullptr}, {"TangentialForceHaffWerner", nullptr} }}
+	};
+}
+
+const std::vector<Scene> scenes{
+	{"gas", "Dilute granular gas in a closed box", 100000, build_gas},
+	{"bed", "Bed of particles at rest on a floor, under gravity", 100000, build_bed},
+	{"hopper", "Particles falling into a V-shaped hopper, under gravity", 100000, build_hopper},
+	{"charged", "Cloud of charged particles, without boundaries", 10000, build_charged_cloud}
+};
+
+const std::vector<std::size_t> defaultSizes{100, 1000, 10000, 100000};
+
+// Silences std::cout, to which the simulator writes debug messages, while it exists
+class MutedOutput
+{
+	public:
+		MutedOutput()
+			: buffer(std::cout.rdbuf(nullptr))
+		{}
+
+		~MutedOutput()
+		{
+			std::cout.rdbuf(this->buffer);
+			std::cout.clear();
+		}
+
+	private:
+		std::streambuf * buffer;
+};
+
+struct Settings
+{
+	std::size_t steps;
+	unsigned threads;
+	string seeker;
+	unsigned seed;
+	path directory;
+};
+
+json run(const Scene & scene, const std::size_t numberOfParticles, const Settings & settings)
+{
+	const path outputFolder = settings.directory / path(scene.name + "-" + std::to_string(numberOfParticles));
+
+	// Every step but the first and the last one runs without output, which would otherwise be timed as well
+	json mainInput{
+		{"InitialInstant", 0.0},
+		{"TimeStep", timeStep},
+		{"FinalInstant", (settings.steps - 0.5) * timeStep},
+		{"StepsForStoring", settings.steps},
+		{"StoragesForWriting", 1},
+		{"IntegrationAlgorithm", "Gear"},
+		{"NumberOfThreads", settings.threads},
+		{"OutputFormat", "Frames"},
+		{"OutputFields", json::array({"Position", "Velocity"})},
+		{"MainOutputFolder", outputFolder},
+		{"ParticleOutputFolder", outputFolder / path("particles")},
+		{"BoundaryOutputFolder", outputFolder / path("boundaries")}
+	};
+	if(settings.seeker == "VerletSeeker") mainInput["Seeker"] = json{ {"VerletSeeker", { {"Skin", radius / 2.0} }} };
+	else mainInput["Seeker"] = settings.seeker;
+
+	std::mt19937 random(settings.seed);
+
+	BenchSimulator simulator;
+	double setupSeconds;
+	double seconds;
+	{
+		MutedOutput muted;
+
+		const auto start = std::chrono::steady_clock::now();
+		{
+			json sceneInput = scene.build(numberOfParticles, random);
+			for(json::iterator it = sceneInput.begin(); it != sceneInput.end(); ++it)
+			{
+				mainInput[it.key()] = std::move(it.value());
+			}
+			simulator.setup(mainInput);
+		}
+		simulator.createDirectories();
+		const auto setupFinish = std::chrono::steady_clock::now();
+
+		simulator.simulate();
+		const auto finish = std::chrono::steady_clock::now();
+
+		setupSeconds = std::chrono::duration<double>(setupFinish - start).count();
+		seconds = std::chrono::duration<double>(finish - setupFinish).count();
+	}
+
+	const json profile = read_json( (outputFolder / path("profile.json")).string() );
+	const double steps = profile.at("Steps");
+
+	json phases = json::array();
+	for(const json & phase : profile.at("Phases"))
+	{
+		const double total = phase.at("Total");
+		phases.push_back(json{
+			{"Name", phase.at("Name")},
+			{"Total", total},
+			{"MeanPerStep", phase.at("MeanPerStep")},
+			{"Fraction", total / seconds}
+		});
+	}
+
+	// Time spent writing output on the writer thread, which overlaps the time loop
+	double outputSeconds = 0.0;
+	for(const json & phase : profile.at("Output").at("Phases"))
+	{
+		outputSeconds += phase.at("Total").get<double>();
+	}
+
+	return json{
+		{"Scene", scene.name},
+		{"Particles", numberOfParticles},
+		{"Steps", steps},
+		{"SetupSeconds", setupSeconds},
+		{"Seconds", seconds},
+		{"StepsPerSecond", steps / seconds},
+		{"ParticleStepsPerSecond", steps * numberOfParticles / seconds},
+		{"Phases", phases},
+		{"OutputSeconds", outputSeconds}
+	};
+}
+
+std::vector<std::size_t> parse_sizes(const string & list)
+{
+	std::vector<std::size_t> sizes;
+	std::istringstream stream(list);
+	string entry;
+	while(std::getline(stream, entry, ','))
+	{
+		// Sizes may be given as powers of ten, such as 1e6
+		const double size = std::stod(entry);
+		if(size < 1.0) throw std::runtime_error("Sizes must be positive: " + entry);
+		sizes.push_back( static_cast<std::size_t>(std::llround(size)) );
+	}
+	return sizes;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+	string sceneNames;
+	for(const Scene & scene : scenes)
+	{
+		sceneNames += (sceneNames.empty() ? "" : ",") + scene.name;
+	}
+
+	program_options::options_description desc("Allowed options");
+	desc.add_options()
+		("help", "produce help message")
+		("scenes", program_options::value<string>()->default_value(sceneNames), "Comma separated scenes to run")
+		("sizes", program_options::value<string>(), "Comma separated numbers of particles, such as 1e2,1e4,1e6. Defaults to 1e2 to 1e5, or each scene's largest default size.")
+		("steps", program_options::value<std::size_t>()->default_value(100), "Time steps of each run")
+		("threads", program_options::value<unsigned>()->default_value(1), "Number of threads")
+		("seeker", program_options::value<string>()->default_value("GridSeeker"), "GridSeeker, VerletSeeker or BlindSeeker")
+		("seed", program_options::value<unsigned>()->default_value(0), "Seed of the random scenes")
+		("directory", program_options::value<string>()->default_value( (filesystem::temp_directory_path() / path("psinBench")).string() ), "Where the simulations write their output")
+		("output", program_options::value<string>()->default_value("psinBench.json"), "Results file")
+	;
+	program_options::variables_map vm = psin::parseCommandLine(
+			argc,
+			argv,
+			desc
+		);
+	if(vm.count("help"))
+	{
+		std::cout << desc << std::endl;
+		return 0;
+	}
+
+	Settings settings{
+		vm["steps"].as<std::size_t>(),
+		vm["threads"].as<unsigned>(),
+		vm["seeker"].as<string>(),
+		vm["seed"].as<unsigned>(),
+		path(vm["directory"].as<string>())
+	};
+	if(settings.steps < 2) throw std::runtime_error("At least two steps are needed");
+
+	std::vector<const Scene *> selectedScenes;
+	{
+		std::istringstream stream(vm["scenes"].as<string>());
+		string name;
+		while(std::getline(stream, name, ','))
+		{
+			const Scene * selected = nullptr;
+			for(const Scene & scene : scenes)
+			{
+				if(scene.name == name) selected = &scene;
+			}
+			if(not selected) throw std::runtime_error("Unknown scene: " + name + ". Scenes are " + sceneNames + ".");
+			selectedScenes.push_back(selected);
+		}
+	}
+
+	const bool explicitSizes = vm.count("sizes") > 0;
+	const std::vector<std::size_t> sizes = explicitSizes ? parse_sizes(vm["sizes"].as<string>()) : defaultSizes;
+
+	json results{
+		{"Steps", settings.steps},
+		{"TimeStep", timeStep},
+		{"NumberOfThreads", settings.threads},
+		{"HardwareThreads", std::thread::hardware_concurrency()},
+		{"Seeker", settings.seeker},
+		{"Seed", settings.seed},
+		{"Clock", "steady_clock"},
+		{"Runs", json::array()}
+	};
+
+	std::cout << std::setw(8) << "scene" << std::setw(10) << "particles" << std::setw(12) << "steps/s" << std::setw(18) << "particle-steps/s" << "  slowest phase" << std::endl;
+
+	for(const Scene * scene : selectedScenes)
+	{
+		for(const std::size_t size : sizes)
+		{
+			if(size > scene->maxDefaultSize and not explicitSizes) continue;
+
+			json result = run(*scene, size, settings);
+
+			json slowest;
+			for(const json & phase : result.at("Phases"))
+			{
+				if(slowest.is_null() or phase.at("Total").get<double>() > slowest.at("Total").get<double>()) slowest = phase;
+			}
+
+			std::cout << std::setw(8) << scene->name
+				<< std::setw(10) << size
+				<< std::setw(12) << std::setprecision(4) << result.at("StepsPerSecond").get<double>()
+				<< std::setw(18) << result.at("ParticleStepsPerSecond").get<double>();
+			if(not slowest.is_null())
+			{
+				std::cout << "  " << slowest.at("Name").get<string>() << " (" << std::setprecision(3) << 100.0 * slowest.at("Fraction").get<double>() << "%)";
+			}
+			std::cout << std::endl;
+
+			results.at("Runs").push_back(result);
+		}
+	}
+
+	std::ofstream(vm["output"].as<string>()) << results.dump(4) << std::endl;
+	std::cout << "Results written to " << vm["output"].as<string>() << std::endl;
+}
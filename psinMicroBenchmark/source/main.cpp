@@ -0,0 +1,580 @@
+// EntityLib
+#include <FixedInfinitePlane.hpp>
+#include <FixedOrderSpatialEntity.hpp>
+#include <GravityField.hpp>
+#include <SphericalParticle.hpp>
+#include <SurroundingFluid.hpp>
+
+// InteractionLib
+#include <ContactHistory.hpp>
+#include <Interaction.hpp>
+#include <InteractionDefinitions.hpp>
+
+// JSONLib
+#include <json.hpp>
+
+// PropertyLib
+#include <PropertyDefinitions.hpp>
+
+// SimulationLib
+#include <IntegratorDefinitions/GearIntegrator.hpp>
+#include <ProgramOptions.hpp>
+
+// UtilsLib
+#include <string.hpp>
+#include <Vector3D.hpp>
+
+// Standard
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace psin;
+
+// psinMicroBenchmark times the kernels a time step is made of, one at a time. Each benchmark is
+// called repeatedly in samples of at least --sample-time seconds; the first --warmup samples are
+// discarded and the others are summarized by their median and their median absolute deviation
+// (MAD), in nanoseconds per operation, which outliers caused by the rest of the machine barely move.
+//
+// --compare base.json new.json prints, for each benchmark in both files, how much its median
+// changed, and marks changes larger than the noise of either run.
+namespace {
+
+constexpr std::size_t numberOfStates = 1000;
+constexpr std::size_t numberOfVectors = 1024;
+constexpr std::size_t numberOfPairs = 256;
+constexpr double timeStep = 1e-5;
+
+const Vector3D acceleration(0.0, 0.0, -9.81);
+
+struct Benchmark
+{
+	string name;
+	// Operations made by each call of run, over which its time is divided
+	std::size_t operations;
+	// Returns a value derived from its results, so that they are not optimized away
+	std::function<double()> run;
+};
+
+struct Settings
+{
+	std::size_t warmup;
+	std::size_t samples;
+	double sampleTime;
+};
+
+double median(std::vector<double> values)
+{
+	std::sort(values.begin(), values.end());
+	const std::size_t middle = values.size() / 2;
+	return values.size() % 2 == 1 ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+}
+
+// Times benchmark and returns its statistics, in nanoseconds per operation
+json measure(const Benchmark & benchmark, const Settings & settings, double & checksum)
+{
+	using Clock = std::chrono::steady_clock;
+
+	// Calls per sample are doubled until a sample takes at least sampleTime
+	std::size_t calls = 1;
+	while(true)
+	{
+		const auto start = Clock::now();
+		for(std::size_t call = 0; call < calls; ++call) checksum += benchmark.run();
+		const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+		if(elapsed >= settings.sampleTime) break;
+		calls *= 2;
+	}
+
+	std::vector<double> samples;
+	for(std::size_t sample = 0; sample < settings.warmup + settings.samples; ++sample)
+	{
+		const auto start = Clock::now();
+		for(std::size_t call = 0; call < calls; ++call) checksum += benchmark.run();
+		const auto finish = Clock::now();
+
+		if(sample >= settings.warmup)
+		{
+			samples.push_back( std::chrono::duration<double, std::nano>(finish - start).count() / (calls * benchmark.operations) );
+		}
+	}
+
+	const double center = median(samples);
+	std::vector<double> deviations;
+	for(const double sample : samples)
+	{
+		deviations.push_back( std::abs(sample - center) );
+	}
+
+	return json{
+		{"Name", benchmark.name},
+		{"Operations", calls * benchmark.operations},
+		{"Samples", samples.size()},
+		{"Median", center},
+		{"MAD", median(deviations)},
+		{"Min", *std::min_element(samples.begin(), samples.end())}
+	};
+}
+
+// ---- Vector3D ----
+
+std::vector<Vector3D> randomVectors(std::mt19937 & random)
+{
+	std::uniform_real_distribution<double> component(-1.0, 1.0);
+
+	std::vector<Vector3D> vectors;
+	for(std::size_t i = 0; i < numberOfVectors; ++i)
+	{
+		vectors.emplace_back(component(random), component(random), component(random));
+	}
+	return vectors;
+}
+
+void addVector3DBenchmarks(std::vector<Benchmark> & benchmarks, std::mt19937 & random)
+{
+	auto a = std::make_shared<std::vector<Vector3D>>(randomVectors(random));
+	auto b = std::make_shared<std::vector<Vector3D>>(randomVectors(random));
+	auto c = std::make_shared<std::vector<Vector3D>>(numberOfVectors);
+
+	benchmarks.push_back({"Vector3D/add", numberOfVectors, [a, b, c]()
+	{
+		for(std::size_t i = 0; i < numberOfVectors; ++i) (*c)[i] = (*a)[i] + (*b)[i];
+		return (*c)[0].x();
+	}});
+	benchmarks.push_back({"Vector3D/scale", numberOfVectors, [a, c]()
+	{
+		for(std::size_t i = 0; i < numberOfVectors; ++i) (*c)[i] = 1.5 * (*a)[i];
+		return (*c)[0].x();
+	}});
+	benchmarks.push_back({"Vector3D/accumulate", numberOfVectors, [a, c]()
+	{
+		for(std::size_t i = 0; i < numberOfVectors; ++i) (*c)[i] += (*a)[i];
+		return (*c)[0].x();
+	}});
+	benchmarks.push_back({"Vector3D/dot", numberOfVectors, [a, b]()
+	{
+		double sum = 0.0;
+		for(std::size_t i = 0; i < numberOfVectors; ++i) sum += dot((*a)[i], (*b)[i]);
+		return sum;
+	}});
+	benchmarks.push_back({"Vector3D/cross", numberOfVectors, [a, b, c]()
+	{
+		for(std::size_t i = 0; i < numberOfVectors; ++i) (*c)[i] = cross((*a)[i], (*b)[i]);
+		return (*c)[0].x();
+	}});
+	benchmarks.push_back({"Vector3D/length", numberOfVectors, [a]()
+	{
+		double sum = 0.0;
+		for(std::size_t i = 0; i < numberOfVectors; ++i) sum += (*a)[i].length();
+		return sum;
+	}});
+	benchmarks.push_back({"Vector3D/normalized", numberOfVectors, [a, c]()
+	{
+		for(std::size_t i = 0; i < numberOfVectors; ++i) (*c)[i] = (*a)[i].normalized();
+		return (*c)[0].x();
+	}});
+}
+
+// ---- Properties ----
+
+void addPropertyBenchmarks(std::vector<Benchmark> & benchmarks)
+{
+	auto masses = std::make_shared<std::vector<Mass>>(numberOfVectors);
+	auto particles = std::make_shared<std::vector<SphericalParticle<Mass>>>(numberOfVectors);
+	for(std::size_t i = 0; i < numberOfVectors; ++i)
+	{
+		(*masses)[i].set(1.0 + i);
+		(*particles)[i].set<Mass>(1.0 + i);
+	}
+
+	benchmarks.push_back({"Property/get", numberOfVectors, [masses]()
+	{
+		double sum = 0.0;
+		for(const Mass & mass : *masses) sum += mass.get();
+		return sum;
+	}});
+	benchmarks.push_back({"Property/getUnchecked", numberOfVectors, [masses]()
+	{
+		double sum = 0.0;
+		for(const Mass & mass : *masses) sum += mass.getUnchecked();
+		return sum;
+	}});
+	benchmarks.push_back({"PhysicalEntity/get", numberOfVectors, [particles]()
+	{
+		double sum = 0.0;
+		for(const auto& particle : *particles) sum += particle.get<Mass>();
+		return sum;
+	}});
+	benchmarks.push_back({"PhysicalEntity/getUnchecked", numberOfVectors, [particles]()
+	{
+		double sum = 0.0;
+		for(const auto& particle : *particles) sum += particle.getUnchecked<Mass>();
+		return sum;
+	}});
+}
+
+// ---- Gear predictor-corrector ----
+
+template<std::size_t TaylorOrder>
+std::vector<Vector3D> initialState()
+{
+	std::vector<Vector3D> state(TaylorOrder + 1);
+	state[0] = Vector3D(0.0, 0.0, 1.0);
+	state[1] = Vector3D(1.0, 0.0, 0.0);
+	return state;
+}
+
+// Interaction<>::taylorPredictor and Interaction<>::gearCorrector, as called before the
+// integrator's coefficients were tabulated, and the fixed-order kernels fed by GearIntegrator's
+// precomputed coefficients. Each operation predicts and corrects one state.
+template<std::size_t TaylorOrder>
+void addGearBenchmarks(std::vector<Benchmark> & benchmarks)
+{
+	using Matrix = std::array<Vector3D, TaylorOrder + 1>;
+
+	auto states = std::make_shared<std::vector< std::vector<Vector3D> >>(numberOfStates, initialState<TaylorOrder>());
+	benchmarks.push_back({"Gear/functions/" + std::to_string(TaylorOrder), numberOfStates, [states]()
+	{
+		for(auto& state : *states)
+		{
+			state = Interaction<>::taylorPredictor(state, TaylorOrder, timeStep);
+			state = Interaction<>::gearCorrector(state, acceleration, 2, TaylorOrder, timeStep);
+		}
+		return (*states)[0][0].z();
+	}});
+
+	const std::vector<Vector3D> initial = initialState<TaylorOrder>();
+	Matrix matrix;
+	std::copy(initial.begin(), initial.end(), matrix.begin());
+	auto matrices = std::make_shared<std::vector<Matrix>>(numberOfStates, matrix);
+	auto coefficients = std::make_shared<GearIntegrator::Coefficients>(timeStep);
+
+	benchmarks.push_back({"Gear/tabulated/" + std::to_string(TaylorOrder), numberOfStates, [matrices, coefficients]()
+	{
+		for(auto& state : *matrices)
+		{
+			Interaction<>::taylorPredict<TaylorOrder>(state, coefficients->predictor());
+			Interaction<>::gearCorrect<2, TaylorOrder>(state, acceleration, coefficients->corrector(2, TaylorOrder));
+		}
+		return (*matrices)[0][0].z();
+	}});
+}
+
+// ---- Contact geometry and interactions ----
+
+using Sphere = SphericalParticle<
+	Mass,
+	MomentOfInertia,
+	ElasticModulus,
+	NormalDissipativeConstant,
+	DissipativeConstant,
+	PoissonRatio,
+	TangentialDamping,
+	TangentialKappa,
+	FrictionParameter,
+	ElectricCharge
+	>;
+using Plane = FixedInfinitePlane<ElasticModulus, NormalDissipativeConstant>;
+using Fluid = SurroundingFluid<SpecificMass>;
+using Time = GearIntegrator::Time<std::size_t, double>;
+
+// Pairs (2i, 2i + 1) of spheres of unit radius, overlapping by a tenth of their radius along a
+// random direction. The first sphere of each pair overlaps the plane z = 0 as much.
+struct Contacts
+{
+	explicit Contacts(std::mt19937 & random)
+		: plane(Vector3D(0, 0, 0), Vector3D(0, 0, 1)),
+		time(0.0, timeStep, 1.0)
+	{
+		std::uniform_real_distribution<double> component(-1.0, 1.0);
+
+		for(std::size_t i = 0; i < 2 * numberOfPairs; ++i)
+		{
+			Sphere sphere("S" + std::to_string(i), 3);
+			sphere.setHandle(i);
+			sphere.set<Radius>(1.0);
+			sphere.set<Mass>(1.0);
+			sphere.set<MomentOfInertia>(0.4);
+			sphere.set<ElasticModulus>(1e5);
+			sphere.set<NormalDissipativeConstant>(10.0);
+			sphere.set<DissipativeConstant>(1e-3);
+			sphere.set<PoissonRatio>(0.3);
+			sphere.set<TangentialDamping>(10.0);
+			sphere.set<TangentialKappa>(1e4);
+			sphere.set<FrictionParameter>(0.5);
+			sphere.set<ElectricCharge>(i % 2 == 0 ? 1e-6 : -1e-6);
+
+			const Vector3D direction = Vector3D(component(random), component(random), component(random)).normalized();
+			const Vector3D position = (i % 2 == 0)
+				? Vector3D(4.0 * i, 0.0, 0.9)
+				: spheres.back().getPosition() + 1.9 * direction;
+			sphere.setPosition(position);
+			sphere.setVelocity( Vector3D(component(random), component(random), component(random)) );
+			sphere.setAngularVelocity( Vector3D(component(random), component(random), component(random)) );
+
+			spheres.push_back(sphere);
+		}
+
+		plane.set<ElasticModulus>(1e5);
+		plane.set<NormalDissipativeConstant>(10.0);
+
+		gravity.set<Gravity>( acceleration );
+		fluid.set<SpecificMass>(1.2);
+
+		time.start();
+
+		// Tangential forces scale the normal force of their pair
+		for(std::size_t pair = 0; pair < numberOfPairs; ++pair)
+		{
+			NormalForceLinearDashpotForce::calculate(spheres[2 * pair], spheres[2 * pair + 1], time);
+		}
+	}
+
+	std::vector<Sphere> spheres;
+	Plane plane;
+	GravityField gravity;
+	Fluid fluid;
+	Time time;
+	ContactHistory<TangentialForceCundallStrack::contact_history_type> history;
+};
+
+// Benchmarks named name, calling pairFunction(particle, neighbor) on every pair
+template<typename PairFunction>
+void addPairBenchmark(std::vector<Benchmark> & benchmarks, const string & name, std::shared_ptr<Contacts> contacts, PairFunction pairFunction)
+{
+	benchmarks.push_back({name, numberOfPairs, [contacts, pairFunction]()
+	{
+		double sum = 0.0;
+		for(std::size_t pair = 0; pair < numberOfPairs; ++pair)
+		{
+			sum += pairFunction(contacts->spheres[2 * pair], contacts->spheres[2 * pair + 1]);
+		}
+		return sum;
+	}});
+}
+
+// Benchmarks named name, calling particleFunction(particle) on every sphere
+template<typename ParticleFunction>
+void addParticleBenchmark(std::vector<Benchmark> & benchmarks, const string & name, std::shared_ptr<Contacts> contacts, ParticleFunction particleFunction)
+{
+	benchmarks.push_back({name, 2 * numberOfPairs, [contacts, particleFunction]()
+	{
+		double sum = 0.0;
+		for(Sphere & sphere : contacts->spheres)
+		{
+			sum += particleFunction(sphere);
+		}
+		return sum;
+	}});
+}
+
+void addContactBenchmarks(std::vector<Benchmark> & benchmarks, std::mt19937 & random)
+{
+	auto contacts = std::make_shared<Contacts>(random);
+	Contacts * c = contacts.get();
+
+	addPairBenchmark(benchmarks, "SphericalParticle/overlap", contacts, [](Sphere & p, Sphere & n){ return overlap(p, n); });
+	addPairBenchmark(benchmarks, "SphericalParticle/normalVersor", contacts, [](Sphere & p, Sphere & n){ return normalVersor(p, n).x(); });
+	addPairBenchmark(benchmarks, "SphericalParticle/relativeTangentialVelocityContactPoint", contacts,
+		[](Sphere & p, Sphere & n){ return relativeTangentialVelocityContactPoint(p, n).x(); });
+	addParticleBenchmark(benchmarks, "SphericalParticle/overlap/plane", contacts, [c](Sphere & p){ return overlap(p, c->plane); });
+	addParticleBenchmark(benchmarks, "SphericalParticle/normalVersor/plane", contacts, [c](Sphere & p){ return normalVersor(p, c->plane).x(); });
+
+	addPairBenchmark(benchmarks, "ElectrostaticForce", contacts,
+		[c](Sphere & p, Sphere & n){ ElectrostaticForce::calculate(p, n, c->time); return p.getBodyForce().x(); });
+	addPairBenchmark(benchmarks, "NormalForceLinearDashpotForce", contacts,
+		[c](Sphere & p, Sphere & n){ return NormalForceLinearDashpotForce::calculate(p, n, c->time).x(); });
+	addParticleBenchmark(benchmarks, "NormalForceLinearDashpotForce/plane", contacts,
+		[c](Sphere & p){ return NormalForceLinearDashpotForce::calculate(p, c->plane, c->time).x(); });
+	addPairBenchmark(benchmarks, "NormalForceViscoelasticSpheres", contacts,
+		[c](Sphere & p, Sphere & n){ return NormalForceViscoelasticSpheres::calculate(p, n, c->time).x(); });
+	addPairBenchmark(benchmarks, "TangentialForceHaffWerner", contacts,
+		[c](Sphere & p, Sphere & n){ TangentialForceHaffWerner::calculate(p, n, c->time); return p.getContactForce().x(); });
+	addPairBenchmark(benchmarks, "TangentialForceCundallStrack", contacts,
+		[c](Sphere & p, Sphere & n){ TangentialForceCundallStrack::calculate(p, n, c->time, c->history); return p.getContactForce().x(); });
+	addParticleBenchmark(benchmarks, "GravityForce", contacts,
+		[c](Sphere & p){ GravityForce::calculate(p, c->gravity, c->time); return p.getBodyForce().x(); });
+	addParticleBenchmark(benchmarks, "DragForce", contacts,
+		[c](Sphere & p){ DragForce::calculate(p, c->fluid, c->time); return p.getBodyForce().x(); });
+}
+
+std::vector<Benchmark> allBenchmarks()
+{
+	std::mt19937 random(0);
+	std::vector<Benchmark> benchmarks;
+
+	addVector3DBenchmarks(benchmarks, random);
+	addPropertyBenchmarks(benchmarks);
+	for(std::size_t taylorOrder = 3; taylorOrder <= GearIntegrator::maxPredictionOrder; ++taylorOrder)
+	{
+		dispatchTaylorOrder(taylorOrder, [&](auto order)
+		{
+			constexpr std::size_t N = decltype(order)::value;
+			if constexpr(N >= 3) addGearBenchmarks<N>(benchmarks);
+		});
+	}
+	addContactBenchmarks(benchmarks, random);
+
+	return benchmarks;
+}
+
+// Silences std::cout, to which some interactions write debug messages, while it exists
+class MutedOutput
+{
+	public:
+		MutedOutput()
+			: buffer(std::cout.rdbuf(nullptr))
+		{}
+
+		~MutedOutput()
+		{
+			std::cout.rdbuf(this->buffer);
+			std::cout.clear();
+		}
+
+	private:
+		std::streambuf * buffer;
+};
+
+int run(const Settings & settings, const string & filter, const string & outputFilePath)
+{
+	double checksum = 0.0;
+	json results{
+		{"Unit", "ns"},
+		{"Warmup", settings.warmup},
+		{"SampleTime", settings.sampleTime},
+		{"Benchmarks", json::array()}
+	};
+
+	std::cout << std::left << std::setw(60) << "benchmark" << std::right << std::setw(12) << "median[ns]" << std::setw(10) << "MAD[ns]" << std::setw(10) << "min[ns]" << std::endl;
+
+	std::vector<Benchmark> benchmarks;
+	{
+		MutedOutput muted;
+		benchmarks = allBenchmarks();
+	}
+
+	for(const Benchmark & benchmark : benchmarks)
+	{
+		if(benchmark.name.find(filter) == string::npos) continue;
+
+		json result;
+		{
+			MutedOutput muted;
+			result = measure(benchmark, settings, checksum);
+		}
+
+		std::cout << std::left << std::setw(60) << benchmark.name << std::right << std::fixed << std::setprecision(2)
+			<< std::setw(12) << result.at("Median").get<double>()
+			<< std::setw(10) << result.at("MAD").get<double>()
+			<< std::setw(10) << result.at("Min").get<double>()
+			<< std::endl;
+
+		results.at("Benchmarks").push_back(result);
+	}
+
+	std::cout << "Checksum: " << std::setprecision(6) << checksum << std::endl;
+
+	if(not outputFilePath.empty())
+	{
+		std::ofstream(outputFilePath) << results.dump(4) << std::endl;
+		std::cout << "Results written to " << outputFilePath << std::endl;
+	}
+	return 0;
+}
+
+// A change is reported as significant when it is larger than three times the MAD of either run
+int compare(const string & baseFilePath, const string & newFilePath)
+{
+	const json base = read_json(baseFilePath);
+	const json current = read_json(newFilePath);
+
+	std::map<string, json> baseResults;
+	for(const json & result : base.at("Benchmarks"))
+	{
+		baseResults[result.at("Name").get<string>()] = result;
+	}
+
+	std::cout << std::left << std::setw(60) << "benchmark" << std::right << std::setw(12) << "base[ns]" << std::setw(12) << "new[ns]" << std::setw(10) << "change" << std::endl;
+
+	for(const json & result : current.at("Benchmarks"))
+	{
+		const string name = result.at("Name");
+		if(baseResults.count(name) == 0) continue;
+		const json & before = baseResults.at(name);
+
+		const double baseMedian = before.at("Median");
+		const double newMedian = result.at("Median");
+		const double noise = 3.0 * std::max( before.at("MAD").get<double>(), result.at("MAD").get<double>() );
+		const bool significant = std::abs(newMedian - baseMedian) > noise;
+
+		std::cout << std::left << std::setw(60) << name << std::right << std::fixed << std::setprecision(2)
+			<< std::setw(12) << baseMedian
+			<< std::setw(12) << newMedian
+			<< std::setw(9) << std::showpos << 100.0 * (newMedian - baseMedian) / baseMedian << std::noshowpos << "%"
+			<< (significant ? (newMedian < baseMedian ? "  faster" : "  slower") : "")
+			<< std::endl;
+	}
+	return 0;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+	program_options::options_description desc("Allowed options");
+	desc.add_options()
+		("help", "produce help message")
+		("filter", program_options::value<string>()->default_value(""), "Only run benchmarks whose name contains this")
+		("warmup", program_options::value<std::size_t>()->default_value(3), "Samples discarded before measuring")
+		("samples", program_options::value<std::size_t>()->default_value(15), "Samples measured")
+		("sample-time", program_options::value<double>()->default_value(0.01), "Least duration of a sample, in seconds")
+		("output", program_options::value<string>()->default_value(""), "Results file")
+		("compare", program_options::value< std::vector<string> >()->multitoken(), "Compares two results files: --compare base.json new.json")
+	;
+	program_options::variables_map vm = psin::parseCommandLine(
+			argc,
+			argv,
+			desc
+		);
+	if(vm.count("help"))
+	{
+		std::cout << desc << std::endl;
+		return 0;
+	}
+
+	if(vm.count("compare"))
+	{
+		const std::vector<string> files = vm["compare"].as< std::vector<string> >();
+		if(files.size() != 2)
+		{
+			std::cerr << "--compare takes two results files" << std::endl;
+			return 1;
+		}
+		return compare(files[0], files[1]);
+	}
+
+	Settings settings{
+		vm["warmup"].as<std::size_t>(),
+		vm["samples"].as<std::size_t>(),
+		vm["sample-time"].as<double>()
+	};
+	if(settings.samples == 0)
+	{
+		std::cerr << "--samples must be positive" << std::endl;
+		return 1;
+	}
+
+	return run(settings, vm["filter"].as<string>(), vm["output"].as<string>());
+}